@@ -51,6 +51,16 @@ namespace sqlpp
 
 			bool operator==(const bind_result_t& rhs) const;
 
+			// Result protocol 2 (optional): sqlpp::result_t binds the row once, when it is constructed and
+			// after it has been moved, i.e. it calls result_row._bind(*this). next() then only fills in the
+			// values and must not call result_row._bind(*this) again. Connectors opt in with
+			//
+			//   struct _tags
+			//   {
+			//     using _binds_result_once = std::true_type;
+			//   };
+			//
+			// Without this tag, next() has to bind the row for every row (protocol 1, see below).
 			template<typename ResultRow>
 			void next(ResultRow& result_row);
 
@@ -86,6 +96,32 @@ namespace sqlpp
 			void _bind_integral_result(size_t index, int64_t* value, bool* is_null);
 			void _bind_text_result(size_t index, const char** text, size_t* len);
 			...
+
+			// Optional: columnar batch fetch, see sqlpp::fetch_batches()
+			template<typename ResultBatch>
+			void next_batch(ResultBatch& batch);
+
+			// something similar to this:
+			/*
+			{
+				batch._bind(*this); // bind the columns of the batch to results
+				size_t rows = 0;
+				while (rows < batch.capacity() and next_impl())
+				{
+					// write the values of the row into the bound arrays at position rows
+					++rows;
+				}
+				batch._set_size(rows); // no rows signal the end of the result
+			};
+			*/
+
+			// These are called by the batch to bind its columns, each with room for capacity values.
+			// A set bit i in null_bitmap (bit i % 8 of byte i / 8) marks a NULL value in row i, all bits are cleared before binding.
+			// Text is appended to data, the text of row i is data[offsets[i], offsets[i + 1]), i.e. offsets[0] is 0.
+			void _bind_boolean_result_array(size_t index, signed char* values, unsigned char* null_bitmap, size_t capacity);
+			void _bind_floating_point_result_array(size_t index, double* values, unsigned char* null_bitmap, size_t capacity);
+			void _bind_integral_result_array(size_t index, int64_t* values, unsigned char* null_bitmap, size_t capacity);
+			void _bind_text_result_array(size_t index, size_t* offsets, std::string* data, unsigned char* null_bitmap, size_t capacity);
 		};
 
 	}
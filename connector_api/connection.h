@@ -40,12 +40,25 @@ namespace sqlpp
 		// The context is not a requirement, but if the database requires 
 		// any deviations from the SQL standard, you should use your own 
 		// context in order to specialize the behaviour, see also interpreter.h
-		struct context_t
+		// The easiest way is to derive from sqlpp::serializer_context_t, which appends to a contiguous buffer.
+		// Its std::ostream& constructor is deprecated: the text reaches the stream only by flush(), str() or destruction,
+		// and operator<< returns the context instead of the stream.
+		// It also offers an auto parameterize mode (see serializer_context_t::auto_parameterize), which replaces
+		// literal values by '?' and collects them, so that statements of the same shape can share one prepared statement.
+		// This mode is not meant to be used with statements that contain parameters.
+		// Connectors that send large text values can use sqlpp::segmented_context_t instead (see sqlpp11/segmented_context.h),
+		// which references those values and hands out a chain of segments, e.g. for writev().
+		struct context_t: public sqlpp::serializer_context_t
 		{
 			template<typename T>
-				std::ostream& operator<<(T t);
+				context_t& operator<<(const T& t); // only required if you want to deviate from serializer_context_t
 
-			std::string escape(std::string arg);
+			static std::string escape(const std::string& arg); // optional, replaces the quote doubling of serializer_context_t for text values
+
+			std::size_t _max_in_list_size() const; // optional, IN(value_list(...)) with more values is split into OR-ed groups
+
+			template<typename Container>
+				void _in_array(bool inverted, const Container& values); // optional, binds value_list(...) as one array, e.g. appends " = ANY(?)"
 		};
 
 		class connection: public sqlpp::connection // this inheritance helps with ADL for dynamic_select, for instance
@@ -108,6 +121,10 @@ namespace sqlpp
 			template<typename PreparedRemove>
 			size_t run_prepared_remove(const PreparedRemove& r); // call r._bind_params()
 
+			//! batch of insert, update and remove statements (see sqlpp11/batch.h), serialized with ';' as separator
+			template<typename Batch>
+			std::vector<size_t> execute_batch(const Batch& b); // one affected-row count per statement, b.size() in total
+
 			//! call run on the argument
 			template<typename T>
 				auto operator() (const T& t) -> decltype(t._run(*this))
@@ -122,6 +139,10 @@ namespace sqlpp
 					return t._prepare(*this);
 				}
 
+			//! optional: derive from sqlpp::cached_prepare_t<connection> (see sqlpp11/prepared_statement_cache.h) to offer
+			//! prepare_cached(t), which returns a shared pointer to a prepared statement from a least recently used cache
+			//! keyed by statement type and dynamic shape
+
 			//! start transaction
 			void start_transaction();
 
@@ -46,7 +46,7 @@ namespace sqlpp
 		};
 
 	template<typename Table>
-		auto all_of(Table t) -> all_of_t<Table>
+		constexpr auto all_of(Table t) -> all_of_t<Table>
 		{
 			return {};
 		}
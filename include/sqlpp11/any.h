@@ -50,7 +50,7 @@ namespace sqlpp
 					};
 			};
 
-			any_t(Select select):
+			constexpr any_t(Select select):
 				_select(select)
 			{}
 
@@ -78,7 +78,7 @@ namespace sqlpp
 		};
 
 	template<typename T>
-		auto any(T t) -> any_t<wrap_operand_t<T>>
+		constexpr auto any(T t) -> any_t<wrap_operand_t<T>>
 		{
 			static_assert(is_select_t<wrap_operand_t<T>>::value, "any() requires a select expression as argument");
 			static_assert(is_expression_t<wrap_operand_t<T>>::value, "any() requires a single column select expression as argument");
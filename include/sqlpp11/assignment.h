@@ -64,14 +64,20 @@ namespace sqlpp
 		struct assignment_t
 		{
 			using _traits = make_traits<no_value_t, ::sqlpp::tag::assignment>;
-			using _recursive_traits = make_recursive_traits<Lhs, Rhs>;
+			struct _recursive_traits: public make_recursive_traits<Lhs, Rhs>
+			{
+				using _tags = detail::make_joined_set_t<recursive_tags_of<Lhs>, recursive_tags_of<Rhs>,
+							typename std::conditional<trivial_value_is_null_t<Lhs>::value, // trivial values are serialized as NULL
+								detail::type_set<tag::contains_variable_shape>,
+								detail::type_set<>>::type>;
+			};
 
 			using _column_t = Lhs;
 			using _value_t = Rhs;
 
 			static_assert(can_be_null_t<_column_t>::value ? true : not std::is_same<_value_t, null_t>::value, "column must not be null");
 
-			assignment_t(_column_t lhs, _value_t rhs):
+			constexpr assignment_t(_column_t lhs, _value_t rhs):
 				_lhs(lhs), 
 				_rhs(rhs)
 			{}
@@ -114,14 +120,14 @@ namespace sqlpp
 		struct assignment_t<Lhs, tvin_t<Rhs>>
 		{
 			using _traits = make_traits<no_value_t, ::sqlpp::tag::assignment>;
-			using _recursive_traits = make_recursive_traits<Lhs, Rhs>;
+			using _recursive_traits = make_recursive_traits<Lhs, tvin_t<Rhs>>;
 
 			using _column_t = Lhs;
 			using _value_t = tvin_t<Rhs>;
 
 			static_assert(can_be_null_t<_column_t>::value, "column cannot be null");
 
-			assignment_t(_column_t lhs, _value_t rhs):
+			constexpr assignment_t(_column_t lhs, _value_t rhs):
 				_lhs(lhs), 
 				_rhs(rhs)
 			{}
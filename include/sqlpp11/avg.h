@@ -53,7 +53,7 @@ namespace sqlpp
 				};
 		};
 
-		avg_t(Expr expr):
+		constexpr avg_t(Expr expr):
 			_expr(expr)
 		{}
 
@@ -86,14 +86,14 @@ namespace sqlpp
 		};
 
 	template<typename T>
-		auto avg(T t) -> avg_t<noop, wrap_operand_t<T>>
+		constexpr auto avg(T t) -> avg_t<noop, wrap_operand_t<T>>
 		{
 			static_assert(is_numeric_t<wrap_operand_t<T>>::value, "avg() requires a value expression as argument");
 			return { t };
 		}
 
 	template<typename T>
-		auto avg(const sqlpp::distinct_t&, T t) -> avg_t<sqlpp::distinct_t, wrap_operand_t<T>>
+		constexpr auto avg(const sqlpp::distinct_t&, T t) -> avg_t<sqlpp::distinct_t, wrap_operand_t<T>>
 		{
 			static_assert(is_numeric_t<wrap_operand_t<T>>::value, "avg() requires a value expression as argument");
 			return { t };
@@ -52,7 +52,7 @@ namespace sqlpp
 				};
 
 			template<typename T>
-				equal_to_t<Base, wrap_operand_t<T>> operator==(T t) const
+				constexpr equal_to_t<Base, wrap_operand_t<T>> operator==(T t) const
 				{
 					using rhs = wrap_operand_t<T>;
 					static_assert(_is_valid_comparison_operand<rhs>::value, "invalid rhs operand in comparison");
@@ -61,7 +61,7 @@ namespace sqlpp
 				}
 
 			template<typename T>
-				not_equal_to_t<Base, wrap_operand_t<T>> operator!=(T t) const
+				constexpr not_equal_to_t<Base, wrap_operand_t<T>> operator!=(T t) const
 				{
 					using rhs = wrap_operand_t<T>;
 					static_assert(_is_valid_comparison_operand<rhs>::value, "invalid rhs operand in comparison");
@@ -70,7 +70,7 @@ namespace sqlpp
 				}
 
 			template<typename T>
-				less_than_t<Base, wrap_operand_t<T>> operator<(T t) const
+				constexpr less_than_t<Base, wrap_operand_t<T>> operator<(T t) const
 				{
 					using rhs = wrap_operand_t<T>;
 					static_assert(_is_valid_comparison_operand<rhs>::value, "invalid rhs operand in comparison");
@@ -79,7 +79,7 @@ namespace sqlpp
 				}
 
 			template<typename T>
-				less_equal_t<Base, wrap_operand_t<T>> operator<=(T t) const
+				constexpr less_equal_t<Base, wrap_operand_t<T>> operator<=(T t) const
 				{
 					using rhs = wrap_operand_t<T>;
 					static_assert(_is_valid_comparison_operand<rhs>::value, "invalid rhs operand in comparison");
@@ -88,7 +88,7 @@ namespace sqlpp
 				}
 
 			template<typename T>
-				greater_than_t<Base, wrap_operand_t<T>> operator>(T t) const
+				constexpr greater_than_t<Base, wrap_operand_t<T>> operator>(T t) const
 				{
 					using rhs = wrap_operand_t<T>;
 					static_assert(_is_valid_comparison_operand<rhs>::value, "invalid rhs operand in comparison");
@@ -97,7 +97,7 @@ namespace sqlpp
 				}
 
 			template<typename T>
-				greater_equal_t<Base, wrap_operand_t<T>> operator>=(T t) const
+				constexpr greater_equal_t<Base, wrap_operand_t<T>> operator>=(T t) const
 				{
 					using rhs = wrap_operand_t<T>;
 					static_assert(_is_valid_comparison_operand<rhs>::value, "invalid rhs operand in comparison");
@@ -105,39 +105,39 @@ namespace sqlpp
 					return { *static_cast<const Base*>(this), rhs{t} };
 				}
 
-			is_null_t<true, Base> is_null() const
+			constexpr is_null_t<true, Base> is_null() const
 			{
 				return { *static_cast<const Base*>(this) };
 			}
 
-			is_null_t<false, Base> is_not_null() const
+			constexpr is_null_t<false, Base> is_not_null() const
 			{
 				return { *static_cast<const Base*>(this) };
 			}
 
-			sort_order_t<Base, sort_type::asc> asc()
+			constexpr sort_order_t<Base, sort_type::asc> asc() const
 			{ 
 				return { *static_cast<const Base*>(this) };
 			}
 
-			sort_order_t<Base, sort_type::desc> desc()
+			constexpr sort_order_t<Base, sort_type::desc> desc() const
 			{ 
 				return { *static_cast<const Base*>(this) };
 			}
 
 			// Hint: use value_list wrapper for containers...
 			template<typename... T>
-				in_t<true, Base, wrap_operand_t<T>...> in(T... t) const
+				constexpr in_t<true, Base, wrap_operand_t<T>...> in(T... t) const
 				{
 					static_assert(detail::all_t<_is_valid_comparison_operand<wrap_operand_t<T>>::value...>::value, "at least one operand of in() is not valid");
-					return { *static_cast<const Base*>(this), wrap_operand_t<T>{t}... };
+					return { *static_cast<const Base*>(this), wrap_operand_t<T>{std::move(t)}... };
 				}
 
 			template<typename... T>
-				in_t<false, Base, wrap_operand_t<T>...> not_in(T... t) const
+				constexpr in_t<false, Base, wrap_operand_t<T>...> not_in(T... t) const
 				{
 					static_assert(detail::all_t<_is_valid_comparison_operand<wrap_operand_t<T>>::value...>::value, "at least one operand of in() is not valid");
-					return { *static_cast<const Base*>(this), wrap_operand_t<T>{t}... };
+					return { *static_cast<const Base*>(this), wrap_operand_t<T>{std::move(t)}... };
 				}
 		};
 
@@ -145,7 +145,7 @@ namespace sqlpp
 		struct alias_operators
 		{
 			template<typename alias_provider>
-				expression_alias_t<Base, alias_provider> as(const alias_provider&)
+				constexpr expression_alias_t<Base, alias_provider> as(const alias_provider&) const
 				{
 					return { *static_cast<const Base*>(this) };
 				}
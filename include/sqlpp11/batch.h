@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_BATCH_H
+#define SQLPP_BATCH_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/interpretable.h>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/update.h>
+#include <sqlpp11/remove.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		template<typename T>
+			struct is_batch_statement_impl: std::false_type {};
+
+		template<typename Db, typename... Policies>
+			struct is_batch_statement_impl<statement_t<Db, insert_t, Policies...>>: std::true_type {};
+
+		template<typename Db, typename... Policies>
+			struct is_batch_statement_impl<statement_t<Db, update_t, Policies...>>: std::true_type {};
+
+		template<typename Db, typename... Policies>
+			struct is_batch_statement_impl<statement_t<Db, remove_t, Policies...>>: std::true_type {};
+	}
+
+	// A list of insert, update and remove statements which are sent to the database in one go.
+	// Running a batch yields the number of affected rows per statement.
+	template<typename Database>
+		struct batch_t
+		{
+			using _traits = make_traits<no_value_t, tag::return_value>;
+			using _recursive_traits = recursive_tags<tag::contains_runtime_data, tag::contains_variable_shape>;
+
+			template<typename Statement>
+				void add(Statement statement)
+				{
+					static_assert(detail::is_batch_statement_impl<Statement>::value, "only insert, update and remove statements can be added to a batch");
+					static_assert(Statement::_get_static_no_of_parameters() == 0, "statements with parameters cannot be added to a batch");
+					Statement::_check_consistency();
+					if (statement._get_no_of_parameters())
+						throw exception("statements with parameters cannot be added to a batch");
+
+					_statements.emplace_back(std::move(statement));
+				}
+
+			std::size_t size() const
+			{
+				return _statements.size();
+			}
+
+			bool empty() const
+			{
+				return _statements.empty();
+			}
+
+			template<typename Db>
+				auto _run(Db& db) const -> decltype(db.execute_batch(*this))
+				{
+					return db.execute_batch(*this);
+				}
+
+			std::vector<interpretable_t<Database>> _statements;
+		};
+
+	template<typename Context, typename Database>
+		struct serializer_t<Context, batch_t<Database>>
+		{
+			using T = batch_t<Database>;
+
+			static Context& _(const T& t, Context& context)
+			{
+				bool first = true;
+				for (const auto& statement : t._statements)
+				{
+					if (first)
+						first = false;
+					else
+						context << ';';
+					serialize(statement, context);
+				}
+				return context;
+			}
+		};
+
+	template<typename Database, typename... Statements>
+		batch_t<Database> batch(const Database&, Statements... statements)
+		{
+			batch_t<Database> result;
+			using swallow = int[];
+			(void) swallow{0, (result.add(std::move(statements)), 0)...};
+			return result;
+		}
+}
+
+#endif
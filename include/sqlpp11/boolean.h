@@ -29,10 +29,12 @@
 
 #include <cstdlib>
 #include <cassert>
+#include <vector>
 #include <ostream>
 #include <sqlpp11/basic_expression_operators.h>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/exception.h>
+#include <sqlpp11/detail/null_bitmap.h>
 
 namespace sqlpp
 {
@@ -158,6 +160,40 @@ namespace sqlpp
 					signed char _value;
 				};
 
+			// A column of a result batch, see result_batch_t. NULL values are zero.
+			template<typename Db>
+				struct _result_column_t
+				{
+					using _value_type = boolean;
+
+					bool is_null(size_t i) const
+					{
+						return _null_bitmap.is_null(i);
+					}
+
+					bool operator[](size_t i) const
+					{
+						return _values[i];
+					}
+
+					void _resize(size_t capacity)
+					{
+						_values.resize(capacity);
+						_null_bitmap._resize(capacity);
+					}
+
+					template<typename Target>
+						void _bind(Target& target, size_t index)
+						{
+							_null_bitmap._clear();
+							target._bind_boolean_result_array(index, _values.data(), _null_bitmap.data(), _values.size());
+						}
+
+				private:
+					std::vector<signed char> _values;
+					null_bitmap_t _null_bitmap;
+				};
+
 			template<typename T>
 				struct _is_valid_operand
 				{
@@ -171,7 +207,7 @@ namespace sqlpp
 				struct expression_operators: public basic_expression_operators<Base, is_boolean_t>
 			{
 				template<typename T>
-					logical_and_t<Base, wrap_operand_t<T>> operator and(T t) const
+					constexpr logical_and_t<Base, wrap_operand_t<T>> operator and(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 						static_assert(_is_valid_operand<rhs>::value, "invalid rhs operand");
@@ -180,7 +216,7 @@ namespace sqlpp
 					}
 
 				template<typename T>
-					logical_or_t<Base, wrap_operand_t<T>> operator or(T t) const
+					constexpr logical_or_t<Base, wrap_operand_t<T>> operator or(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 						static_assert(_is_valid_operand<rhs>::value, "invalid rhs operand");
@@ -188,7 +224,7 @@ namespace sqlpp
 						return { *static_cast<const Base*>(this), rhs{t} };
 					}
 
-				logical_not_t<Base> operator not() const
+				constexpr logical_not_t<Base> operator not() const
 				{
 					return { *static_cast<const Base*>(this) };
 				}
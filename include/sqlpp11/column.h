@@ -52,6 +52,7 @@ namespace sqlpp
 			using _provided_tables = detail::type_set<>;
 			using _required_tables = detail::type_set<Table>;
 			using _extra_tables = detail::type_set<>;
+			using _tags = detail::type_set<>;
 		};
 
 		using _spec_t = ColumnSpec;
@@ -75,13 +76,13 @@ namespace sqlpp
 		}
 
 		template<typename alias_provider>
-			expression_alias_t<column_t, alias_provider> as(const alias_provider&) const
+			constexpr expression_alias_t<column_t, alias_provider> as(const alias_provider&) const
 			{
 				return { *this };
 			}
 
 		template<typename T>
-			auto operator =(T t) const -> assignment_t<column_t, wrap_operand_t<T>>
+			constexpr auto operator =(T t) const -> assignment_t<column_t, wrap_operand_t<T>>
 			{
 				using rhs = wrap_operand_t<T>;
 				static_assert(_is_valid_operand<rhs>::value, "invalid rhs operand assignment operand");
@@ -89,14 +90,14 @@ namespace sqlpp
 				return { *this, rhs{t} };
 			}
 
-		auto operator =(sqlpp::null_t) const
+		constexpr auto operator =(sqlpp::null_t) const
 			->assignment_t<column_t, sqlpp::null_t>
 			{
 				static_assert(can_be_null_t<column_t>::value, "column cannot be null");
 				return { *this, {} };
 			}
 
-		auto operator =(sqlpp::default_value_t) const
+		constexpr auto operator =(sqlpp::default_value_t) const
 			->assignment_t<column_t, sqlpp::default_value_t>
 			{
 				return { *this, {} };
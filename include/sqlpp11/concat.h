@@ -54,7 +54,7 @@ namespace sqlpp
 				};
 		};
 
-		concat_t(First first, Args... args):
+		constexpr concat_t(First first, Args... args):
 			_args(first, args...)
 		{}
 
@@ -39,19 +39,19 @@ namespace sqlpp
 		template<typename T>
 			struct as_tuple
 			{
-				static std::tuple<T> _(T t) { return std::tuple<T>{ t }; }
+				static constexpr std::tuple<T> _(T t) { return std::tuple<T>{ t }; }
 			};
 
 		template<typename T>
 			struct as_tuple<::sqlpp::all_of_t<T>>
 			{
-				static typename ::sqlpp::all_of_t<T>::_column_tuple_t _(::sqlpp::all_of_t<T>) { return { }; }
+				static constexpr typename ::sqlpp::all_of_t<T>::_column_tuple_t _(::sqlpp::all_of_t<T>) { return { }; }
 			};
 
 		template<typename... Args>
 			struct as_tuple<std::tuple<Args...>>
 			{
-				static std::tuple<Args...> _(std::tuple<Args...> t) { return t; }
+				static constexpr std::tuple<Args...> _(std::tuple<Args...> t) { return t; }
 			};
 
 		template<template<typename, typename...> class Target, typename First, typename T>
@@ -39,23 +39,37 @@ namespace sqlpp
 			struct index_sequence
 			{};
 
-		template<typename T, std::size_t N>
-			struct make_index_sequence_impl;
+		template<typename Lhs, typename Rhs>
+			struct concat_index_sequence;
 
-		template<std::size_t N, std::size_t... Ints>
-			struct make_index_sequence_impl<index_sequence<Ints...>, N>
+		template<std::size_t... L, std::size_t... R>
+			struct concat_index_sequence<index_sequence<L...>, index_sequence<R...>>
 			{
-				using type = typename make_index_sequence_impl<index_sequence<Ints..., sizeof...(Ints)>, N - 1>::type;
+				using type = index_sequence<L..., (sizeof...(L) + R)...>;
 			};
 
-		template<std::size_t... Ints>
-			struct make_index_sequence_impl<index_sequence<Ints...>, 0>
+		// Halves N in each step, so the instantiation depth is logarithmic
+		template<std::size_t N>
+			struct make_index_sequence_impl
+			{
+				using type = typename concat_index_sequence<typename make_index_sequence_impl<N / 2>::type,
+							typename make_index_sequence_impl<N - N / 2>::type>::type;
+			};
+
+		template<>
+			struct make_index_sequence_impl<0>
+			{
+				using type = index_sequence<>;
+			};
+
+		template<>
+			struct make_index_sequence_impl<1>
 			{
-				using type = index_sequence<Ints...>;
+				using type = index_sequence<0>;
 			};
 
 		template<std::size_t N>
-			using make_index_sequence = typename make_index_sequence_impl<index_sequence<>, N>::type;
+			using make_index_sequence = typename make_index_sequence_impl<N>::type;
 
 	}
 }
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_DETAIL_NULL_BITMAP_H
+#define SQLPP_DETAIL_NULL_BITMAP_H
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// One bit per row of a result column, a set bit marks a NULL value.
+		// Connectors set the bits, see _bind_*_result_array() in connector_api/bind_result.h
+		class null_bitmap_t
+		{
+			std::vector<unsigned char> _bits;
+
+		public:
+			void _resize(std::size_t capacity)
+			{
+				_bits.resize((capacity + 7) / 8);
+			}
+
+			void _clear()
+			{
+				std::fill(_bits.begin(), _bits.end(), 0);
+			}
+
+			bool is_null(std::size_t i) const
+			{
+				return (_bits[i / 8] >> (i % 8)) & 1;
+			}
+
+			unsigned char* data()
+			{
+				return _bits.data();
+			}
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_DETAIL_NUMBER_FORMAT_H
+#define SQLPP_DETAIL_NUMBER_FORMAT_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// Large enough for any 64 bit integer and for "%.17g" formatted doubles, including the terminating zero
+		constexpr std::size_t number_buffer_size = 32;
+		// Maximum lengths of the formatted numbers (without the terminating zero)
+		constexpr std::size_t max_integral_length = 20; // -9223372036854775808
+		constexpr std::size_t max_floating_point_length = 24; // -1.2345678901234567e-308
+
+		inline const char* digit_pairs()
+		{
+			return
+				"00010203040506070809"
+				"10111213141516171819"
+				"20212223242526272829"
+				"30313233343536373839"
+				"40414243444546474849"
+				"50515253545556575859"
+				"60616263646566676869"
+				"70717273747576777879"
+				"80818283848586878889"
+				"90919293949596979899";
+		}
+
+		// Writes the decimal representation of value into the end of the buffer (zero terminated).
+		// Returns a pointer to the first character. Does not depend on the current locale.
+		template<typename T>
+			const char* integral_to_chars(T value, char (&buffer)[number_buffer_size])
+			{
+				static_assert(std::is_integral<T>::value, "integral_to_chars() requires an integral type");
+				using _unsigned_t = typename std::make_unsigned<T>::type;
+
+				_unsigned_t u = static_cast<_unsigned_t>(value);
+				const bool negative = value < T{};
+				if (negative)
+					u = static_cast<_unsigned_t>(_unsigned_t{} - u);
+
+				const char* pairs = digit_pairs();
+				char* begin = buffer + number_buffer_size - 1;
+				*begin = '\0';
+				while (u >= 100)
+				{
+					const std::size_t index = static_cast<std::size_t>(u % 100) * 2;
+					u /= 100;
+					*--begin = pairs[index + 1];
+					*--begin = pairs[index];
+				}
+				if (u >= 10)
+				{
+					const std::size_t index = static_cast<std::size_t>(u) * 2;
+					*--begin = pairs[index + 1];
+					*--begin = pairs[index];
+				}
+				else
+				{
+					*--begin = static_cast<char>('0' + u);
+				}
+				if (negative)
+					*--begin = '-';
+				return begin;
+			}
+
+		// Rounds the first precision digits of a 17 digit mantissa in place.
+		// Returns true if the rounding carried over into a new leading digit (e.g. 9.99 -> 10.0)
+		inline bool round_digits(char* digits, int precision)
+		{
+			if (digits[precision] < '5')
+				return false;
+			for (int i = precision - 1; i >= 0; --i)
+			{
+				if (digits[i] != '9')
+				{
+					++digits[i];
+					return false;
+				}
+				digits[i] = '0';
+			}
+			digits[0] = '1';
+			return true;
+		}
+
+		// Checks if digits * 10^exponent reads back as value.
+		// The check avoids a decimal point, so it does not depend on the current locale.
+		inline bool reads_back_as(double value, bool negative, const char* digits, int precision, int exponent)
+		{
+			char text[number_buffer_size];
+			char* pos = text;
+			if (negative)
+				*pos++ = '-';
+			std::memcpy(pos, digits, static_cast<std::size_t>(precision));
+			pos += precision;
+			*pos++ = 'e';
+			char exponent_buffer[number_buffer_size];
+			const char* exponent_text = integral_to_chars(exponent - precision + 1, exponent_buffer);
+			std::strcpy(pos, exponent_text);
+			return std::strtod(text, nullptr) == value;
+		}
+
+		// Writes the shortest representation with 15, 16 or 17 significant digits (minus trailing zeros)
+		// that reads back as the same double into the buffer (zero terminated). The layout follows printf's "%g",
+		// but the decimal point is always '.', independent of the current locale.
+		inline const char* floating_point_to_chars(double value, char (&buffer)[number_buffer_size])
+		{
+			// whole numbers are formatted like integers
+			if (value > -1e15 and value < 1e15 and value == static_cast<double>(static_cast<int64_t>(value)))
+			{
+				const char* text = integral_to_chars(static_cast<int64_t>(value), buffer);
+				if (value == 0 and std::signbit(value))
+				{
+					std::strcpy(buffer, "-0");
+					return buffer;
+				}
+				return text;
+			}
+
+			if (not std::isfinite(value))
+			{
+				std::snprintf(buffer, number_buffer_size, "%g", value);
+				return buffer;
+			}
+
+			// "%.16e" yields [-]d.dddddddddddddddde[+-]xx, i.e. 17 significant digits
+			char scientific[number_buffer_size];
+			std::snprintf(scientific, number_buffer_size, "%.16e", value);
+			const bool negative = scientific[0] == '-';
+			const char* pos = scientific + (negative ? 1 : 0);
+			char digits[18];
+			int digit_count = 0;
+			while (digit_count < 17)
+			{
+				if (*pos >= '0' and *pos <= '9')
+					digits[digit_count++] = *pos;
+				++pos;
+			}
+			digits[17] = '\0';
+			while (*pos != 'e' and *pos != 'E')
+				++pos;
+			int exponent = std::atoi(pos + 1);
+
+			int precision = 17;
+			for (int candidate = 15; candidate < 17; ++candidate)
+			{
+				char rounded[18];
+				std::memcpy(rounded, digits, sizeof(rounded));
+				const int rounded_exponent = exponent + (round_digits(rounded, candidate) ? 1 : 0);
+				if (reads_back_as(value, negative, rounded, candidate, rounded_exponent))
+				{
+					std::memcpy(digits, rounded, static_cast<std::size_t>(candidate));
+					exponent = rounded_exponent;
+					precision = candidate;
+					break;
+				}
+				// a trailing 5 may be the result of rounding the exact value up, so rounding down might be correct
+				if (digits[candidate] == '5' and std::strspn(digits + candidate + 1, "0") == static_cast<std::size_t>(16 - candidate)
+						and reads_back_as(value, negative, digits, candidate, exponent))
+				{
+					precision = candidate;
+					break;
+				}
+			}
+			while (precision > 1 and digits[precision - 1] == '0')
+				--precision;
+
+			char* out = buffer;
+			if (negative)
+				*out++ = '-';
+			if (exponent < -4 or exponent >= 17)
+			{
+				*out++ = digits[0];
+				if (precision > 1)
+				{
+					*out++ = '.';
+					std::memcpy(out, digits + 1, static_cast<std::size_t>(precision - 1));
+					out += precision - 1;
+				}
+				*out++ = 'e';
+				*out++ = exponent < 0 ? '-' : '+';
+				const int absolute_exponent = exponent < 0 ? -exponent : exponent;
+				if (absolute_exponent < 10)
+					*out++ = '0';
+				char exponent_buffer[number_buffer_size];
+				std::strcpy(out, integral_to_chars(absolute_exponent, exponent_buffer));
+			}
+			else if (exponent < 0)
+			{
+				*out++ = '0';
+				*out++ = '.';
+				for (int i = -1; i > exponent; --i)
+					*out++ = '0';
+				std::memcpy(out, digits, static_cast<std::size_t>(precision));
+				out += precision;
+				*out = '\0';
+			}
+			else
+			{
+				for (int i = 0; i <= exponent; ++i)
+					*out++ = i < precision ? digits[i] : '0';
+				if (precision > exponent + 1)
+				{
+					*out++ = '.';
+					std::memcpy(out, digits + exponent + 1, static_cast<std::size_t>(precision - exponent - 1));
+					out += precision - exponent - 1;
+				}
+				*out = '\0';
+			}
+			return buffer;
+		}
+	}
+}
+
+#endif
@@ -28,26 +28,28 @@
 #define SQLPP_DETAIL_PICK_ARG_H
 
 #include <type_traits>
+#include <utility>
 
 namespace sqlpp
 {
 	namespace detail
 	{
 		template<typename Target, typename Statement, typename Term>
-			typename Target::_data_t pick_arg_impl(Statement statement, Term term, const std::true_type&)
+			constexpr typename Target::_data_t pick_arg_impl(Statement& statement, Term& term, const std::true_type&)
 			{
-				return term;
+				return std::move(term);
 			};
 
 		template<typename Target, typename Statement, typename Term>
-			typename Target::_data_t pick_arg_impl(Statement statement, Term term, const std::false_type&)
+			constexpr typename Target::_data_t pick_arg_impl(Statement& statement, Term& term, const std::false_type&)
 			{
-				return Target::_get_member(statement)._data;
+				return std::move(Target::_get_data(statement));
 			};
 
-		// Returns a statement's term either by picking the term from the statement or using the new term
+		// Returns a statement's term either by picking the term from the statement or using the new term.
+		// Both arguments are owned by the caller and each part is picked exactly once, so it is moved.
 		template<typename Target, typename Statement, typename Term>
-			typename Target::_data_t pick_arg(Statement statement, Term term)
+			constexpr typename Target::_data_t pick_arg(Statement& statement, Term& term)
 			{
 				return pick_arg_impl<Target>(statement, term, std::is_same<typename Target::_data_t, Term>());
 			};
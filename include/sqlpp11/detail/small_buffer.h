@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_DETAIL_SMALL_BUFFER_H
+#define SQLPP_DETAIL_SMALL_BUFFER_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// Interface for objects stored in a small_buffer_t
+		struct small_buffer_base_t
+		{
+			virtual small_buffer_base_t* _copy_to(void* buffer) const = 0;
+			virtual small_buffer_base_t* _move_to(void* buffer) = 0; // returns this, if the object lives on the heap
+			virtual void _destroy() = 0;
+			virtual ~small_buffer_base_t() = default;
+		};
+
+		template<std::size_t Size>
+			using small_buffer_storage_t = typename std::aligned_storage<Size, alignof(void*)>::type;
+
+		// Implements the small_buffer_base_t interface for Impl, which derives from Base (and Base from small_buffer_base_t)
+		template<typename Base, typename Impl, std::size_t Size>
+			struct small_buffer_impl_t: public Base
+			{
+				static constexpr bool _is_inline()
+				{
+					return sizeof(Impl) <= Size
+						and alignof(Impl) <= alignof(small_buffer_storage_t<Size>)
+						and std::is_nothrow_move_constructible<Impl>::value;
+				}
+
+				small_buffer_base_t* _copy_to(void* buffer) const
+				{
+					return _create(buffer, *static_cast<const Impl*>(this));
+				}
+
+				small_buffer_base_t* _move_to(void* buffer)
+				{
+					return _is_inline() ? _create(buffer, std::move(*static_cast<Impl*>(this))) : this;
+				}
+
+				void _destroy()
+				{
+					if (_is_inline())
+						static_cast<Impl*>(this)->~Impl();
+					else
+						delete static_cast<Impl*>(this);
+				}
+
+				template<typename... Args>
+					static Impl* _create(void* buffer, Args&&... args)
+					{
+						return _is_inline() ? new (buffer) Impl(std::forward<Args>(args)...) : new Impl(std::forward<Args>(args)...);
+					}
+			};
+
+		// Owns one object derived from Base. Small objects are stored inline, larger ones on the heap.
+		// Copies are deep copies, so there is no shared state (and no reference counting) between copies.
+		template<typename Base, std::size_t Size>
+			class small_buffer_t
+			{
+				small_buffer_storage_t<Size> _buffer;
+				Base* _object = nullptr;
+
+				void _reset()
+				{
+					if (_object)
+						_object->_destroy();
+					_object = nullptr;
+				}
+
+				void _take(small_buffer_t& rhs) noexcept
+				{
+					if (rhs._object)
+					{
+						_object = static_cast<Base*>(rhs._object->_move_to(&_buffer));
+						if (_object != rhs._object)
+							rhs._object->_destroy();
+						rhs._object = nullptr;
+					}
+				}
+
+			public:
+				template<typename Impl, typename... Args>
+					static small_buffer_t create(Args&&... args)
+					{
+						small_buffer_t result;
+						result._object = Impl::_create(&result._buffer, std::forward<Args>(args)...);
+						return result;
+					}
+
+				small_buffer_t() = default;
+
+				small_buffer_t(const small_buffer_t& rhs):
+					_object(rhs._object ? static_cast<Base*>(rhs._object->_copy_to(&_buffer)) : nullptr)
+				{}
+
+				small_buffer_t(small_buffer_t&& rhs) noexcept
+				{
+					_take(rhs);
+				}
+
+				small_buffer_t& operator=(const small_buffer_t& rhs)
+				{
+					if (this != &rhs)
+					{
+						_reset();
+						if (rhs._object)
+							_object = static_cast<Base*>(rhs._object->_copy_to(&_buffer));
+					}
+					return *this;
+				}
+
+				small_buffer_t& operator=(small_buffer_t&& rhs) noexcept
+				{
+					if (this != &rhs)
+					{
+						_reset();
+						_take(rhs);
+					}
+					return *this;
+				}
+
+				~small_buffer_t()
+				{
+					_reset();
+				}
+
+				const Base* operator->() const
+				{
+					return _object;
+				}
+			};
+	}
+}
+
+#endif
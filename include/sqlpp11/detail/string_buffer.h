@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_DETAIL_STRING_BUFFER_H
+#define SQLPP_DETAIL_STRING_BUFFER_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// A contiguous, growable character buffer.
+		// Short texts are kept in an inline buffer, longer ones move to the heap (growing geometrically).
+		class string_buffer_t
+		{
+		public:
+			static constexpr std::size_t _inline_capacity = 256;
+
+			string_buffer_t():
+				_data(_inline),
+				_size(0),
+				_capacity(_inline_capacity)
+			{}
+
+			string_buffer_t(const string_buffer_t& rhs):
+				string_buffer_t()
+			{
+				append(rhs._data, rhs._size);
+			}
+
+			string_buffer_t(string_buffer_t&& rhs):
+				string_buffer_t()
+			{
+				_take(rhs);
+			}
+
+			string_buffer_t& operator=(const string_buffer_t& rhs)
+			{
+				if (this != &rhs)
+				{
+					clear();
+					append(rhs._data, rhs._size);
+				}
+				return *this;
+			}
+
+			string_buffer_t& operator=(string_buffer_t&& rhs)
+			{
+				if (this != &rhs)
+				{
+					clear();
+					_take(rhs);
+				}
+				return *this;
+			}
+
+			~string_buffer_t() = default;
+
+			void append(char c)
+			{
+				if (_size == _capacity)
+					_grow(1);
+				_data[_size++] = c;
+			}
+
+			void append(const char* s, std::size_t len)
+			{
+				if (len > _capacity - _size)
+					_grow(len);
+				std::memcpy(_data + _size, s, len);
+				_size += len;
+			}
+
+			// Makes room for len characters at the end of the buffer and returns a pointer to them
+			char* extend(std::size_t len)
+			{
+				if (len > _capacity - _size)
+					_grow(len);
+				char* result = _data + _size;
+				_size += len;
+				return result;
+			}
+
+			// Removes len characters from the end of the buffer, e.g. after extend() reserved too much
+			void shrink(std::size_t len)
+			{
+				_size -= len;
+			}
+
+			void reserve(std::size_t capacity)
+			{
+				if (capacity > _capacity)
+					_reallocate(capacity);
+			}
+
+			void clear()
+			{
+				_size = 0;
+			}
+
+			const char* data() const { return _data; }
+			std::size_t size() const { return _size; }
+			std::size_t capacity() const { return _capacity; }
+			bool empty() const { return _size == 0; }
+
+			std::string str() const
+			{
+				return std::string(_data, _size);
+			}
+
+		private:
+			void _grow(std::size_t len)
+			{
+				const std::size_t required = _size + len;
+				const std::size_t doubled = 2 * _capacity;
+				_reallocate(doubled > required ? doubled : required);
+			}
+
+			void _reallocate(std::size_t capacity)
+			{
+				std::unique_ptr<char[]> heap(new char[capacity]);
+				std::memcpy(heap.get(), _data, _size);
+				_heap = std::move(heap);
+				_data = _heap.get();
+				_capacity = capacity;
+			}
+
+			void _take(string_buffer_t& rhs)
+			{
+				if (rhs._heap)
+				{
+					_heap = std::move(rhs._heap);
+					_data = _heap.get();
+					_size = rhs._size;
+					_capacity = rhs._capacity;
+					rhs._data = rhs._inline;
+					rhs._capacity = _inline_capacity;
+				}
+				else
+				{
+					append(rhs._data, rhs._size);
+				}
+				rhs._size = 0;
+			}
+
+			char _inline[_inline_capacity];
+			std::unique_ptr<char[]> _heap;
+			char* _data;
+			std::size_t _size;
+			std::size_t _capacity;
+		};
+	}
+}
+
+#endif
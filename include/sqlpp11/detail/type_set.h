@@ -31,6 +31,7 @@
 #include <type_traits>
 #include <sqlpp11/wrong.h>
 #include <sqlpp11/detail/logic.h>
+#include <sqlpp11/detail/index_sequence.h>
 
 namespace sqlpp
 {
@@ -43,19 +44,26 @@ namespace sqlpp
 		template<typename E, typename SET>
 			struct is_element_of;
 
+		// Each element of a type set is a base class of the set.
+		// This turns membership tests into a single std::is_base_of instead of a comparison with each element.
+		template<typename E>
+			struct type_set_element
+			{
+				using type = E;
+			};
+
 		// A type set
+		// Note: Duplicates are rejected by the compiler (duplicate base class), use make_type_set to construct a set
 		template<typename... Elements>
-			struct type_set
+			struct type_set: type_set_element<Elements>...
 		{
-			using size = std::integral_constant<size_t, sizeof...(Elements)>;
+			using size = std::integral_constant<std::size_t, sizeof...(Elements)>;
 			using _is_type_set = std::true_type;
 
-			static_assert(std::is_same<type_set, typename make_type_set<Elements...>::type>::value, "use make_type_set to construct a set");
-
 			template<typename T>
 				struct insert
 				{
-					using type = typename std::conditional<not is_element_of<T, type_set>::value,
+					using type = typename std::conditional<not std::is_base_of<type_set_element<T>, type_set>::value,
 								type_set<T, Elements...>,
 								type_set>::type;
 				};
@@ -63,12 +71,90 @@ namespace sqlpp
 			template<template<typename A> class Predicate, typename T>
 				struct insert_if
 				{
-					using type = typename std::conditional<Predicate<T>::value and not is_element_of<T, type_set>::value,
+					using type = typename std::conditional<Predicate<T>::value and not std::is_base_of<type_set_element<T>, type_set>::value,
 								type_set<Elements..., T>,
 								type_set>::type;
 				};
 		};
 
+		// A list of types which may contain duplicates, indexed by position.
+		// Since the element bases are wrapped with their index, duplicates are allowed and show up as ambiguous bases.
+		template<std::size_t Index, typename T>
+			struct type_pack_element: type_set_element<T>
+			{};
+
+		template<typename Indexes, typename... T>
+			struct type_pack_impl;
+
+		template<std::size_t... Indexes, typename... T>
+			struct type_pack_impl<index_sequence<Indexes...>, T...>: type_pack_element<Indexes, T>...
+			{};
+
+		template<typename... T>
+			using type_pack = type_pack_impl<make_index_sequence<sizeof...(T)>, T...>;
+
+		template<typename Pack, typename T>
+			using is_unique_in_pack = std::is_convertible<Pack*, type_set_element<T>*>;
+
+		template<std::size_t Index, typename T>
+			type_set_element<T> type_pack_at_impl(const type_pack_element<Index, T>*); // only used in decltype
+
+		template<std::size_t Index, typename Pack>
+			using type_pack_at = typename decltype(type_pack_at_impl<Index>(std::declval<Pack*>()))::type;
+
+		// Concatenates type sets (or lists of types in a type_set, which might contain duplicates, see make_type_set).
+		// Consumes four lists per step to keep the instantiation depth low.
+		template<typename... Sets>
+			struct type_set_cat;
+
+		template<>
+			struct type_set_cat<>
+			{
+				using type = type_set<>;
+			};
+
+		template<typename... A>
+			struct type_set_cat<type_set<A...>>
+			{
+				using type = type_set<A...>;
+			};
+
+		template<typename... A, typename... B>
+			struct type_set_cat<type_set<A...>, type_set<B...>>
+			{
+				using type = type_set<A..., B...>;
+			};
+
+		template<typename... A, typename... B, typename... C>
+			struct type_set_cat<type_set<A...>, type_set<B...>, type_set<C...>>
+			{
+				using type = type_set<A..., B..., C...>;
+			};
+
+		template<typename... A, typename... B, typename... C, typename... D, typename... Rest>
+			struct type_set_cat<type_set<A...>, type_set<B...>, type_set<C...>, type_set<D...>, Rest...>
+			{
+				using type = typename type_set_cat<type_set<A..., B..., C..., D...>, Rest...>::type;
+			};
+
+		template<typename List>
+			struct type_set_reverse;
+
+		template<typename Indexes, typename... T>
+			struct type_set_reverse_impl;
+
+		template<std::size_t... Indexes, typename... T>
+			struct type_set_reverse_impl<index_sequence<Indexes...>, T...>
+			{
+				using _pack = type_pack<T...>;
+				using type = type_set<type_pack_at<sizeof...(T) - 1 - Indexes, _pack>...>;
+			};
+
+		template<typename... T>
+			struct type_set_reverse<type_set<T...>>
+			{
+				using type = typename type_set_reverse_impl<make_index_sequence<sizeof...(T)>, T...>::type;
+			};
 
 		template<typename E, typename SET>
 			struct is_element_of
@@ -79,7 +165,7 @@ namespace sqlpp
 		template<typename E, typename... Elements>
 			struct is_element_of<E, type_set<Elements...>>
 			{
-				static constexpr bool value = any_t<std::is_same<E, Elements>::value...>::value;
+				static constexpr bool value = std::is_base_of<type_set_element<E>, type_set<Elements...>>::value;
 			};
 
 		template<typename L, typename R>
@@ -88,10 +174,15 @@ namespace sqlpp
 				static_assert(::sqlpp::wrong_t<L, R>::value, "L and R have to be type sets");
 			};
 
+		// Elements of L which are also in R are dropped, the remaining ones are followed by R (same order as make_type_set<L..., R...>)
 		template<typename... LElements, typename... RElements>
 			struct joined_set<type_set<LElements...>, type_set<RElements...>>
 			{
-				using type = typename make_type_set<LElements..., RElements...>::type;
+				using type = typename type_set_cat<
+					typename std::conditional<is_element_of<LElements, type_set<RElements...>>::value,
+						type_set<>,
+						type_set<LElements>>::type...,
+					type_set<RElements...>>::type;
 			};
 
 		template<typename L, typename R>
@@ -106,7 +197,7 @@ namespace sqlpp
 		template<typename... LElements, typename... RElements>
 			struct is_superset_of<type_set<LElements...>, type_set<RElements...>>
 			{
-				static constexpr bool value = joined_set_t<type_set<LElements...>, type_set<RElements...>>::size::value == sizeof...(LElements);
+				static constexpr bool value = all_t<is_element_of<RElements, type_set<LElements...>>::value...>::value;
 			};
 
 		template<typename L, typename R>
@@ -124,37 +215,76 @@ namespace sqlpp
 		template<typename... LElements, typename... RElements>
 			struct is_disjunct_from<type_set<LElements...>, type_set<RElements...>>
 			{
-				static constexpr bool value = joined_set_t<type_set<LElements...>, type_set<RElements...>>::size::value == sizeof...(LElements) + sizeof...(RElements);
+				static constexpr bool value = none_t<is_element_of<LElements, type_set<RElements...>>::value...>::value;
 			};
 
-		template<>
-			struct make_type_set<>
+		// An element is kept if it does not occur again later on, i.e. the last of several duplicates is kept
+		template<std::size_t Index, typename T, typename Indexes, typename... All>
+			struct is_last_in_pack;
+
+		template<std::size_t Index, typename T, std::size_t... Indexes, typename... All>
+			struct is_last_in_pack<Index, T, index_sequence<Indexes...>, All...>
 			{
-				using type = type_set<>;
+				static constexpr bool value = none_t<(Indexes > Index and std::is_same<T, All>::value)...>::value;
+			};
+
+		template<typename Indexes, typename... T>
+			struct make_type_set_impl;
+
+		template<std::size_t... Indexes, typename... T>
+			struct make_type_set_impl<index_sequence<Indexes...>, T...>
+			{
+				using _pack = type_pack_impl<index_sequence<Indexes...>, T...>;
+
+				template<std::size_t Index, typename E>
+					using _keep = typename std::conditional<is_unique_in_pack<_pack, E>::value,
+								std::true_type,
+								is_last_in_pack<Index, E, index_sequence<Indexes...>, T...>>::type;
+
+				using type = typename type_set_cat<typename std::conditional<_keep<Indexes, T>::value,
+							type_set<T>,
+							type_set<>>::type...>::type;
 			};
 
-		template<typename T, typename... Rest>
-			struct make_type_set<T, Rest...>
+		template<typename T>
+			struct type_set_identity
 			{
-				using type = typename make_type_set<Rest...>::type::template insert<T>::type;
+				using type = T;
+			};
+
+		template<typename... T>
+			struct has_duplicates
+			: std::integral_constant<bool, not all_t<is_unique_in_pack<type_pack<T...>, T>::value...>::value>
+			{};
+
+		template<typename... T>
+			struct make_type_set
+			{
+				using type = typename std::conditional<has_duplicates<T...>::value,
+							make_type_set_impl<make_index_sequence<sizeof...(T)>, T...>,
+							type_set_identity<type_set<T...>>>::type::type;
 			};
 
 		template<typename... T>
 			using make_type_set_t = typename make_type_set<T...>::type;
 
-		template<template<typename> class Predicate, typename... T>
-			struct make_type_set_if;
+		template<typename List>
+			struct make_type_set_from_list;
 
-		template<template<typename> class Predicate>
-			struct make_type_set_if<Predicate>
+		template<typename... T>
+			struct make_type_set_from_list<type_set<T...>>
 			{
-				using type = type_set<>;
+				using type = make_type_set_t<T...>;
 			};
 
-		template<template<typename> class Predicate, typename T, typename... Rest>
-			struct make_type_set_if<Predicate, T, Rest...>
+		// Same order as inserting the elements one by one from the back, i.e. the reverse of make_type_set
+		template<template<typename> class Predicate, typename... T>
+			struct make_type_set_if
 			{
-				using type = typename make_type_set_if<Predicate, Rest...>::type::template insert_if<Predicate, T>::type;
+				using _filtered = typename type_set_cat<typename std::conditional<Predicate<T>::value,
+							type_set<T>,
+							type_set<>>::type...>::type;
+				using type = typename type_set_reverse<typename make_type_set_from_list<_filtered>::type>::type;
 			};
 
 		template<template<typename> class Predicate, typename... T>
@@ -168,9 +298,6 @@ namespace sqlpp
 				using type = typename make_type_set_if<InversePredicate, T...>::type;
 			};
 
-		template<typename... T>
-			using has_duplicates = std::integral_constant<bool, make_type_set<T...>::type::size::value != sizeof...(T)>;
-
 		template<typename... T>
 			struct make_joined_set
 			{
@@ -183,12 +310,16 @@ namespace sqlpp
 				using type = type_set<>;
 			};
 
-		template<typename... E, typename... T>
-			struct make_joined_set<type_set<E...>, T...>
+		template<typename... E>
+			struct make_joined_set<type_set<E...>>
+			{
+				using type = type_set<E...>;
+			};
+
+		template<typename... A, typename... B, typename... T>
+			struct make_joined_set<type_set<A...>, type_set<B...>, T...>
 			{
-				using _rest = typename make_joined_set<T...>::type;
-				
-				using type = joined_set_t<type_set<E...>, _rest>;
+				using type = joined_set_t<type_set<A...>, typename make_joined_set<type_set<B...>, T...>::type>;
 			};
 
 		template<typename... Sets>
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_DYNAMIC_FIELD_H
+#define SQLPP_DYNAMIC_FIELD_H
+
+#include <new>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <sqlpp11/boolean.h>
+#include <sqlpp11/integral.h>
+#include <sqlpp11/floating_point.h>
+#include <sqlpp11/text.h>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/detail/number_format.h>
+
+namespace sqlpp
+{
+	// The value type of a dynamic result column, which is only known at runtime
+	enum class dynamic_field_type_t
+	{
+		boolean,
+		integral,
+		floating_point,
+		text
+	};
+
+	namespace detail
+	{
+		// Value types without a result binding of their own are fetched as text
+		template<typename Expr>
+			constexpr dynamic_field_type_t dynamic_field_type_of()
+			{
+				return is_boolean_t<Expr>::value ? dynamic_field_type_t::boolean
+					: is_integral_t<Expr>::value ? dynamic_field_type_t::integral
+					: is_floating_point_t<Expr>::value ? dynamic_field_type_t::floating_point
+					: dynamic_field_type_t::text;
+			}
+	}
+
+	// A field of a dynamic result column. It binds according to the column's value type,
+	// e.g. row.at("max_id").integral().value() returns an int64_t without a detour via text.
+	// Only the result entry of that type is stored.
+	// value() returns the text representation for all value types. Numbers are formatted by sqlpp11,
+	// not by the server, e.g. 1.50 is returned as "1.5". NULL is returned as "" for all value types.
+	template<typename Db>
+		struct dynamic_field_t
+		{
+			using _boolean_entry_t = detail::boolean::_result_entry_t<Db, false>;
+			using _integral_entry_t = detail::integral::_result_entry_t<Db, false>;
+			using _floating_point_entry_t = detail::floating_point::_result_entry_t<Db, false>;
+			using _text_entry_t = detail::text::_result_entry_t<Db, false>;
+
+			static_assert(std::is_trivially_copyable<_boolean_entry_t>::value
+					and std::is_trivially_copyable<_integral_entry_t>::value
+					and std::is_trivially_copyable<_floating_point_entry_t>::value
+					and std::is_trivially_copyable<_text_entry_t>::value,
+					"result entries are stored in a union and need to be trivially copyable");
+
+			dynamic_field_t(dynamic_field_type_t type = dynamic_field_type_t::text):
+				_type(type)
+			{
+				switch (_type)
+				{
+				case dynamic_field_type_t::boolean:
+					new (&_boolean) _boolean_entry_t();
+					return;
+				case dynamic_field_type_t::integral:
+					new (&_integral) _integral_entry_t();
+					return;
+				case dynamic_field_type_t::floating_point:
+					new (&_floating_point) _floating_point_entry_t();
+					return;
+				case dynamic_field_type_t::text:
+					new (&_text) _text_entry_t();
+					return;
+				}
+			}
+
+			dynamic_field_type_t get_type() const
+			{
+				return _type;
+			}
+
+			const _boolean_entry_t& boolean() const
+			{
+				_check_type(dynamic_field_type_t::boolean);
+				return _boolean;
+			}
+
+			const _integral_entry_t& integral() const
+			{
+				_check_type(dynamic_field_type_t::integral);
+				return _integral;
+			}
+
+			const _floating_point_entry_t& floating_point() const
+			{
+				_check_type(dynamic_field_type_t::floating_point);
+				return _floating_point;
+			}
+
+			const _text_entry_t& text() const
+			{
+				_check_type(dynamic_field_type_t::text);
+				return _text;
+			}
+
+			bool is_null() const
+			{
+				switch (_type)
+				{
+				case dynamic_field_type_t::boolean:
+					return _boolean.is_null();
+				case dynamic_field_type_t::integral:
+					return _integral.is_null();
+				case dynamic_field_type_t::floating_point:
+					return _floating_point.is_null();
+				case dynamic_field_type_t::text:
+					break;
+				}
+				return _text.is_null();
+			}
+
+			std::string value() const
+			{
+				char buffer[detail::number_buffer_size];
+				switch (_type)
+				{
+				case dynamic_field_type_t::boolean:
+					{
+						const auto value = _boolean.value(); // throws for NULL unless NULL is a trivial value
+						return _boolean.is_null() ? "" : value ? "1" : "0";
+					}
+				case dynamic_field_type_t::integral:
+					{
+						const auto value = _integral.value();
+						return _integral.is_null() ? "" : detail::integral_to_chars(value, buffer);
+					}
+				case dynamic_field_type_t::floating_point:
+					{
+						const auto value = _floating_point.value();
+						return _floating_point.is_null() ? "" : detail::floating_point_to_chars(value, buffer);
+					}
+				case dynamic_field_type_t::text:
+					break;
+				}
+				return _text.value();
+			}
+
+			operator std::string() const { return value(); }
+
+			bool operator==(const std::string& rhs) const { return value() == rhs; }
+			bool operator!=(const std::string& rhs) const { return not operator==(rhs); }
+
+			void _validate()
+			{
+				switch (_type)
+				{
+				case dynamic_field_type_t::boolean:
+					_boolean._validate();
+					return;
+				case dynamic_field_type_t::integral:
+					_integral._validate();
+					return;
+				case dynamic_field_type_t::floating_point:
+					_floating_point._validate();
+					return;
+				case dynamic_field_type_t::text:
+					_text._validate();
+					return;
+				}
+			}
+
+			void _invalidate()
+			{
+				switch (_type)
+				{
+				case dynamic_field_type_t::boolean:
+					_boolean._invalidate();
+					return;
+				case dynamic_field_type_t::integral:
+					_integral._invalidate();
+					return;
+				case dynamic_field_type_t::floating_point:
+					_floating_point._invalidate();
+					return;
+				case dynamic_field_type_t::text:
+					_text._invalidate();
+					return;
+				}
+			}
+
+			template<typename Target>
+				void _bind(Target& target, size_t i)
+				{
+					switch (_type)
+					{
+					case dynamic_field_type_t::boolean:
+						_boolean._bind(target, i);
+						return;
+					case dynamic_field_type_t::integral:
+						_integral._bind(target, i);
+						return;
+					case dynamic_field_type_t::floating_point:
+						_floating_point._bind(target, i);
+						return;
+					case dynamic_field_type_t::text:
+						_text._bind(target, i);
+						return;
+					}
+				}
+
+		private:
+			void _check_type(dynamic_field_type_t type) const
+			{
+				if (type != _type)
+					throw exception("accessing dynamic field with the wrong value type");
+			}
+
+			dynamic_field_type_t _type;
+			union
+			{
+				_boolean_entry_t _boolean;
+				_integral_entry_t _integral;
+				_floating_point_entry_t _floating_point;
+				_text_entry_t _text;
+			};
+		};
+
+	template<typename Db>
+		inline std::ostream& operator<<(std::ostream& os, const dynamic_field_t<Db>& f)
+		{
+			return os << f.value();
+		}
+}
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_DYNAMIC_PARAMETER_LIST_H
+#define SQLPP_DYNAMIC_PARAMETER_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/serialize.h>
+#include <sqlpp11/detail/type_id.h>
+
+namespace sqlpp
+{
+	template<typename ValueType, typename NameType>
+		struct parameter_t;
+
+	namespace detail
+	{
+		// The types of parameters in dynamic statement parts are only known at runtime, they bind through this interface
+		struct parameter_target_base_t
+		{
+			virtual void _bind_boolean_parameter(size_t index, const signed char* value, bool is_null) = 0;
+			virtual void _bind_floating_point_parameter(size_t index, const double* value, bool is_null) = 0;
+			virtual void _bind_integral_parameter(size_t index, const int64_t* value, bool is_null) = 0;
+			virtual void _bind_text_parameter(size_t index, const std::string* value, bool is_null) = 0;
+			virtual ~parameter_target_base_t() = default;
+		};
+
+		// Forwards to the prepared statement of a connector, translating the indexes if required
+		template<typename Target>
+			struct parameter_target_t: public parameter_target_base_t
+			{
+				Target& _target;
+				const std::vector<std::size_t>* _indices;
+
+				parameter_target_t(Target& target, const std::vector<std::size_t>* indices = nullptr):
+					_target(target),
+					_indices(indices)
+				{}
+
+				size_t _get_index(size_t index) const
+				{
+					return _indices ? (*_indices)[index] : index;
+				}
+
+				void _bind_boolean_parameter(size_t index, const signed char* value, bool is_null)
+				{
+					_target._bind_boolean_parameter(_get_index(index), value, is_null);
+				}
+
+				void _bind_floating_point_parameter(size_t index, const double* value, bool is_null)
+				{
+					_target._bind_floating_point_parameter(_get_index(index), value, is_null);
+				}
+
+				void _bind_integral_parameter(size_t index, const int64_t* value, bool is_null)
+				{
+					_target._bind_integral_parameter(_get_index(index), value, is_null);
+				}
+
+				void _bind_text_parameter(size_t index, const std::string* value, bool is_null)
+				{
+					_target._bind_text_parameter(_get_index(index), value, is_null);
+				}
+			};
+	}
+
+	// The parameters of the dynamic parts of a prepared statement, e.g.
+	//
+	//   auto s = dynamic_select(db, all_of(t)).from(t).dynamic_where(t.alpha == parameter(t.alpha));
+	//   s.where.add(t.beta == parameter(t.beta));
+	//   auto p = db.prepare(s);
+	//   p.params.alpha = 7;
+	//   p.dynamic_params[parameter(t.beta)] = "cheesecake";
+	//
+	// Dynamic parameters are identified by their type (value type and name). Occurrences in several
+	// dynamic parts share one value. When the statement is prepared, each parameter is assigned its
+	// position in the statement text, so static parameters following a dynamic part are moved back.
+	class dynamic_parameter_list_t
+	{
+		struct _parameter_base_t
+		{
+			virtual std::unique_ptr<_parameter_base_t> _clone() const = 0;
+			virtual void _bind(detail::parameter_target_base_t& target, std::size_t index) const = 0;
+			virtual ~_parameter_base_t() = default;
+		};
+
+		template<typename ValueType>
+			struct _parameter_impl_t: public _parameter_base_t
+			{
+				typename ValueType::_parameter_t _parameter;
+
+				std::unique_ptr<_parameter_base_t> _clone() const
+				{
+					return std::unique_ptr<_parameter_base_t>(new _parameter_impl_t(*this));
+				}
+
+				void _bind(detail::parameter_target_base_t& target, std::size_t index) const
+				{
+					_parameter._bind(target, index);
+				}
+			};
+
+		struct _entry_t
+		{
+			const void* _type;
+			std::unique_ptr<_parameter_base_t> _parameter;
+		};
+
+		std::vector<_entry_t> _parameters;
+		std::vector<std::size_t> _static_indices; // position of each static parameter in the statement
+		std::vector<std::pair<std::size_t, std::size_t>> _dynamic_indices; // position and entry of each dynamic occurrence
+
+		template<typename Parameter>
+			std::size_t _find() const
+			{
+				const void* type = &detail::type_id_t<Parameter>::_id;
+				std::size_t i = 0;
+				while (i < _parameters.size() and _parameters[i]._type != type)
+					++i;
+				return i;
+			}
+
+		template<typename ValueType, typename NameType>
+			_parameter_impl_t<ValueType>& _get(const parameter_t<ValueType, NameType>&) const
+			{
+				const auto i = _find<parameter_t<ValueType, NameType>>();
+				if (i == _parameters.size())
+					throw exception(std::string("no dynamic parameter named ") + NameType::_name_t::_get_name());
+				return static_cast<_parameter_impl_t<ValueType>&>(*_parameters[i]._parameter);
+			}
+
+	public:
+		dynamic_parameter_list_t() = default;
+
+		dynamic_parameter_list_t(const dynamic_parameter_list_t& rhs):
+			_static_indices(rhs._static_indices),
+			_dynamic_indices(rhs._dynamic_indices)
+		{
+			_parameters.reserve(rhs._parameters.size());
+			for (const auto& entry : rhs._parameters)
+				_parameters.push_back({entry._type, entry._parameter->_clone()});
+		}
+
+		dynamic_parameter_list_t(dynamic_parameter_list_t&&) = default;
+
+		dynamic_parameter_list_t& operator=(const dynamic_parameter_list_t& rhs)
+		{
+			dynamic_parameter_list_t copy(rhs);
+			return *this = std::move(copy);
+		}
+
+		dynamic_parameter_list_t& operator=(dynamic_parameter_list_t&&) = default;
+		~dynamic_parameter_list_t() = default;
+
+		template<typename ValueType, typename NameType>
+			typename ValueType::_parameter_t& operator[](const parameter_t<ValueType, NameType>& parameter)
+			{
+				return _get(parameter)._parameter;
+			}
+
+		template<typename ValueType, typename NameType>
+			const typename ValueType::_parameter_t& operator[](const parameter_t<ValueType, NameType>& parameter) const
+			{
+				return _get(parameter)._parameter;
+			}
+
+		// Number of distinct dynamic parameters
+		std::size_t size() const
+		{
+			return _parameters.size();
+		}
+
+		bool empty() const
+		{
+			return _parameters.empty();
+		}
+
+		// Number of placeholders in dynamic parts
+		std::size_t _get_no_of_occurrences() const
+		{
+			return _dynamic_indices.size();
+		}
+
+		void _add_static_parameter(std::size_t index)
+		{
+			_static_indices.push_back(index);
+		}
+
+		template<typename ValueType, typename NameType>
+			void _add_dynamic_parameter(const parameter_t<ValueType, NameType>&, std::size_t index)
+			{
+				const auto i = _find<parameter_t<ValueType, NameType>>();
+				if (i == _parameters.size())
+					_parameters.push_back({&detail::type_id_t<parameter_t<ValueType, NameType>>::_id, std::unique_ptr<_parameter_base_t>(new _parameter_impl_t<ValueType>())});
+				_dynamic_indices.emplace_back(index, i);
+			}
+
+		template<typename StaticParameters, typename Target>
+			void _bind(const StaticParameters& params, Target& target) const
+			{
+				detail::parameter_target_t<Target> static_target(target, &_static_indices);
+				params._bind(static_target);
+
+				detail::parameter_target_t<Target> dynamic_target(target);
+				for (const auto& occurrence : _dynamic_indices)
+					_parameters[occurrence.second]._parameter->_bind(dynamic_target, occurrence.first);
+			}
+	};
+
+	// A context that does not produce text, but assigns each parameter its position in the statement.
+	// Dynamic parts without parameters are skipped.
+	struct parameter_index_context_t
+	{
+		dynamic_parameter_list_t& _parameters;
+		std::size_t _index;
+		bool _in_dynamic_part;
+
+		explicit parameter_index_context_t(dynamic_parameter_list_t& parameters):
+			_parameters(parameters),
+			_index(0),
+			_in_dynamic_part(false)
+		{}
+
+		template<typename T>
+			parameter_index_context_t& operator<<(const T&)
+			{
+				return *this;
+			}
+
+		// Taking the pointer by value avoids odr-using static constexpr names like op::plus::_name
+		parameter_index_context_t& operator<<(const char*)
+		{
+			return *this;
+		}
+
+		template<typename... T>
+			void append(const T&...)
+			{
+			}
+
+		template<typename... T>
+			void append_escaped(const T&...)
+			{
+			}
+	};
+
+	template<typename ValueType, typename NameType>
+		struct serializer_t<parameter_index_context_t, parameter_t<ValueType, NameType>>
+		{
+			using T = parameter_t<ValueType, NameType>;
+
+			static parameter_index_context_t& _(const T& t, parameter_index_context_t& context)
+			{
+				if (context._in_dynamic_part)
+					context._parameters._add_dynamic_parameter(t, context._index);
+				else
+					context._parameters._add_static_parameter(context._index);
+				++context._index;
+				return context;
+			}
+		};
+
+	namespace detail
+	{
+		// Called by dynamic parts that contain parameters
+		template<typename T>
+			void index_dynamic_parameters(const T& t, parameter_index_context_t& context)
+			{
+				const auto in_dynamic_part = context._in_dynamic_part;
+				context._in_dynamic_part = true;
+				serialize(t, context);
+				context._in_dynamic_part = in_dynamic_part;
+			}
+
+		template<typename Statement>
+			dynamic_parameter_list_t make_dynamic_parameter_list(const Statement& statement, const std::true_type&)
+			{
+				dynamic_parameter_list_t parameters;
+				parameter_index_context_t context(parameters);
+				serialize(statement, context);
+				if (parameters.empty())
+					return {};
+				return parameters;
+			}
+
+		// Statements without database have no dynamic parts
+		template<typename Statement>
+			dynamic_parameter_list_t make_dynamic_parameter_list(const Statement&, const std::false_type&)
+			{
+				return {};
+			}
+	}
+}
+
+#endif
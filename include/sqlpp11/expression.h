@@ -44,7 +44,7 @@ namespace sqlpp
 			using _traits = make_traits<boolean, sqlpp::tag::expression>;
 			using _recursive_traits = make_recursive_traits<Lhs, Rhs>;
 
-			binary_expression_t(Lhs lhs, Rhs rhs):
+			constexpr binary_expression_t(Lhs lhs, Rhs rhs):
 				_lhs(lhs), 
 				_rhs(rhs)
 			{}
@@ -89,7 +89,7 @@ namespace sqlpp
 			using _traits = make_traits<boolean, sqlpp::tag::expression>;
 			using _recursive_traits = make_recursive_traits<Lhs, Rhs>;
 
-			binary_expression_t(Lhs lhs, Rhs rhs):
+			constexpr binary_expression_t(Lhs lhs, Rhs rhs):
 				_lhs(lhs), 
 				_rhs(rhs)
 			{}
@@ -134,7 +134,7 @@ namespace sqlpp
 			using _traits = make_traits<boolean, sqlpp::tag::expression>;
 			using _recursive_traits = make_recursive_traits<Rhs>;
 
-			unary_expression_t(Rhs rhs):
+			constexpr unary_expression_t(Rhs rhs):
 				_rhs(rhs)
 			{}
 
@@ -169,7 +169,7 @@ namespace sqlpp
 		using _traits = make_traits<value_type_of<O>, sqlpp::tag::expression>;
 		using _recursive_traits = make_recursive_traits<Lhs, Rhs>;
 
-		binary_expression_t(Lhs lhs, Rhs rhs):
+		constexpr binary_expression_t(Lhs lhs, Rhs rhs):
 			_lhs(lhs), 
 			_rhs(rhs)
 		{}
@@ -207,7 +207,7 @@ namespace sqlpp
 		using _traits = make_traits<value_type_of<O>, sqlpp::tag::expression>;
 		using _recursive_traits = make_recursive_traits<Rhs>;
 
-		unary_expression_t(Rhs rhs):
+		constexpr unary_expression_t(Rhs rhs):
 			_rhs(rhs)
 		{}
 
@@ -27,6 +27,7 @@
 #ifndef SQLPP_EXTRA_TABLES_H
 #define SQLPP_EXTRA_TABLES_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/detail/logic.h>
 #include <sqlpp11/policy_update.h>
@@ -58,6 +59,7 @@ namespace sqlpp
 				using _required_tables = ::sqlpp::detail::type_set<>;
 				using _provided_tables = ::sqlpp::detail::type_set<>;
 				using _extra_tables = ::sqlpp::detail::type_set<Tables...>;
+				using _tags = ::sqlpp::detail::type_set<>;
 			};
 
 			// FIXME: extra_tables must not require tables!
@@ -87,7 +89,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return extra_tables; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.extra_tables)
+						static constexpr auto _get_member(T& t) -> decltype((t.extra_tables))
 						{
 							return t.extra_tables;
 						}
@@ -128,7 +130,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_extra_tables; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_extra_tables)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_extra_tables))
 					{
 						return t.no_extra_tables;
 					}
@@ -143,10 +145,17 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto extra_tables(Args...)
+					constexpr auto extra_tables(Args...) const &
 					-> _new_statement_t<extra_tables_t<Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), extra_tables_data_t<Args...>{} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), extra_tables_data_t<Args...>{} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto extra_tables(Args...) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<extra_tables_t<Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), extra_tables_data_t<Args...>{} };
 					}
 			};
 	};
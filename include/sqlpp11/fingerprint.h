@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_FINGERPRINT_H
+#define SQLPP_FINGERPRINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <sqlpp11/type_traits.h>
+#include <sqlpp11/serialize.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		constexpr uint64_t fingerprint_basis = 14695981039346656037ull;
+		constexpr uint64_t fingerprint_prime = 1099511628211ull;
+
+		constexpr uint64_t fingerprint_mix(uint64_t hash, char c)
+		{
+			return (hash ^ static_cast<unsigned char>(c)) * fingerprint_prime;
+		}
+
+		constexpr uint64_t fingerprint_combine(uint64_t lhs, uint64_t rhs)
+		{
+			return lhs ^ (rhs + 0x9e3779b97f4a7c15ull + (lhs << 6) + (lhs >> 2));
+		}
+
+		// Splits the range in halves to keep the recursion depth of constant evaluation logarithmic
+		constexpr uint64_t fingerprint_range(const char* s, std::size_t n)
+		{
+			return n == 0 ? fingerprint_basis
+				: n == 1 ? fingerprint_mix(fingerprint_basis, s[0])
+				: fingerprint_combine(fingerprint_range(s, n / 2), fingerprint_range(s + n / 2, n - n / 2));
+		}
+
+		// The function signature spells out T, i.e. all policies, tables and columns of a statement, but no values
+		template<typename T>
+			struct type_fingerprint
+			{
+				static constexpr uint64_t _get()
+				{
+					return fingerprint_range(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1);
+				}
+			};
+	}
+
+	// A context that hashes what decides the shape of an expression instead of producing its text:
+	// Sub expressions without a variable shape contribute the fingerprint of their type (see serialize() below),
+	// only the text around runtime decisions is hashed, literal values as placeholders.
+	// Value lists contribute their size only, see functions.h.
+	struct fingerprint_context_t
+	{
+		uint64_t _hash = detail::fingerprint_basis;
+
+		template<typename T>
+			fingerprint_context_t& operator<<(const T& t)
+			{
+				append(t);
+				return *this;
+			}
+
+		fingerprint_context_t& operator<<(const char* s)
+		{
+			append(s);
+			return *this;
+		}
+
+		void append(char c)
+		{
+			_hash = detail::fingerprint_mix(_hash, c);
+		}
+
+		void append(const char* s, std::size_t len)
+		{
+			for (const char* end = s + len; s != end; ++s)
+				_hash = detail::fingerprint_mix(_hash, *s);
+		}
+
+		void append(const char* s)
+		{
+			for (; *s; ++s)
+				_hash = detail::fingerprint_mix(_hash, *s);
+		}
+
+		void append(const std::string& s)
+		{
+			append(s.data(), s.size());
+		}
+
+		void append(bool b)
+		{
+			append(b ? '1' : '0');
+		}
+
+		template<typename T>
+			auto append(T t)
+			-> typename std::enable_if<std::is_integral<T>::value, void>::type
+			{
+				_mix(static_cast<uint64_t>(t));
+			}
+
+		void append_escaped(const std::string& s)
+		{
+			append(s);
+		}
+
+		template<typename T>
+			bool _parameterize_literal(const T&)
+			{
+				append('?');
+				return true;
+			}
+
+		void _mix(uint64_t hash)
+		{
+			_hash = detail::fingerprint_combine(_hash, hash);
+		}
+	};
+
+	namespace detail
+	{
+		// Types with traits can tell if their shape is variable, others (like policy data) have to be inspected
+		template<typename T, typename Enable = void>
+			struct may_have_variable_shape_impl: std::true_type {};
+
+		template<typename T>
+			struct may_have_variable_shape_impl<T, typename std::conditional<false, typename T::_recursive_traits::_tags, void>::type>:
+			std::integral_constant<bool, contains_variable_shape_t<T>::value> {};
+
+		template<typename T>
+			fingerprint_context_t& fingerprint_serialize(const T& t, fingerprint_context_t& context, const std::true_type&)
+			{
+				serializer_t<fingerprint_context_t, T>::_(t, context);
+				return context;
+			}
+
+		template<typename T>
+			fingerprint_context_t& fingerprint_serialize(const T&, fingerprint_context_t& context, const std::false_type&)
+			{
+				context._mix(type_fingerprint<T>::_get());
+				return context;
+			}
+	}
+
+	// The text of sub expressions without a variable shape is determined by their type, so they are not walked
+	template<typename T>
+		fingerprint_context_t& serialize(const T& t, fingerprint_context_t& context)
+		{
+			return detail::fingerprint_serialize(t, context, detail::may_have_variable_shape_impl<T>{});
+		}
+
+	namespace detail
+	{
+		template<typename T>
+			uint64_t fingerprint_impl(const T&, const std::false_type&)
+			{
+				return type_fingerprint<T>::_get();
+			}
+
+		template<typename T>
+			uint64_t fingerprint_impl(const T& t, const std::true_type&)
+			{
+				fingerprint_context_t context;
+				serialize(t, context);
+				return fingerprint_combine(type_fingerprint<T>::_get(), context._hash);
+			}
+	}
+
+	// The fingerprint identifies the shape of an expression, i.e. its text without literal values.
+	// It is a compile time constant unless runtime data (like dynamic parts, tvin or value lists) changes the shape.
+	// Fingerprints are not meant to be stable across compilers.
+	template<typename T>
+		uint64_t fingerprint(const T& t)
+		{
+			return detail::fingerprint_impl(t, std::integral_constant<bool, contains_variable_shape_t<T>::value>{});
+		}
+}
+
+#endif
@@ -29,9 +29,11 @@
 
 #include <cstdlib>
 #include <cassert>
+#include <vector>
 #include <sqlpp11/basic_expression_operators.h>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/exception.h>
+#include <sqlpp11/detail/null_bitmap.h>
 
 namespace sqlpp
 {
@@ -159,6 +161,45 @@ namespace sqlpp
 					_cpp_value_type _value;
 				};
 
+			// A column of a result batch, see result_batch_t. NULL values are zero.
+			template<typename Db>
+				struct _result_column_t
+				{
+					using _value_type = floating_point;
+
+					bool is_null(size_t i) const
+					{
+						return _null_bitmap.is_null(i);
+					}
+
+					_cpp_value_type operator[](size_t i) const
+					{
+						return _values[i];
+					}
+
+					const _cpp_value_type* data() const
+					{
+						return _values.data();
+					}
+
+					void _resize(size_t capacity)
+					{
+						_values.resize(capacity);
+						_null_bitmap._resize(capacity);
+					}
+
+					template<typename Target>
+						void _bind(Target& target, size_t index)
+						{
+							_null_bitmap._clear();
+							target._bind_floating_point_result_array(index, _values.data(), _null_bitmap.data(), _values.size());
+						}
+
+				private:
+					std::vector<_cpp_value_type> _values;
+					null_bitmap_t _null_bitmap;
+				};
+
 			template<typename T>
 				struct _is_valid_operand
 				{
@@ -172,7 +213,7 @@ namespace sqlpp
 				struct expression_operators: public basic_expression_operators<Base, is_numeric_t>
 			{
 				template<typename T>
-					plus_t<Base, floating_point, wrap_operand_t<T>> operator +(T t) const
+					constexpr plus_t<Base, floating_point, wrap_operand_t<T>> operator +(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 						static_assert(_is_valid_operand<rhs>::value, "invalid rhs operand");
@@ -181,7 +222,7 @@ namespace sqlpp
 					}
 
 				template<typename T>
-					minus_t<Base, floating_point, wrap_operand_t<T>> operator -(T t) const
+					constexpr minus_t<Base, floating_point, wrap_operand_t<T>> operator -(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 						static_assert(_is_valid_operand<rhs>::value, "invalid rhs operand");
@@ -190,7 +231,7 @@ namespace sqlpp
 					}
 
 				template<typename T>
-					multiplies_t<Base, floating_point, wrap_operand_t<T>> operator *(T t) const
+					constexpr multiplies_t<Base, floating_point, wrap_operand_t<T>> operator *(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 
@@ -198,19 +239,19 @@ namespace sqlpp
 					}
 
 				template<typename T>
-					divides_t<Base, wrap_operand_t<T>> operator /(T t) const
+					constexpr divides_t<Base, wrap_operand_t<T>> operator /(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 
 						return { *static_cast<const Base*>(this), rhs{t} };
 					}
 
-				unary_plus_t<floating_point, Base> operator +() const
+				constexpr unary_plus_t<floating_point, Base> operator +() const
 				{
 					return { *static_cast<const Base*>(this) };
 				}
 
-				unary_minus_t<floating_point, Base> operator -() const
+				constexpr unary_minus_t<floating_point, Base> operator -() const
 				{
 					return { *static_cast<const Base*>(this) };
 				}
@@ -220,7 +261,7 @@ namespace sqlpp
 				struct column_operators
 				{
 					template<typename T>
-						auto operator +=(T t) const -> assignment_t<Base, plus_t<Base, floating_point, wrap_operand_t<T>>>
+						constexpr auto operator +=(T t) const -> assignment_t<Base, plus_t<Base, floating_point, wrap_operand_t<T>>>
 						{
 							using rhs = wrap_operand_t<T>;
 							static_assert(_is_valid_operand<rhs>::value, "invalid rhs assignment operand");
@@ -229,7 +270,7 @@ namespace sqlpp
 						}
 
 					template<typename T>
-						auto operator -=(T t) const -> assignment_t<Base, minus_t<Base, floating_point, wrap_operand_t<T>>>
+						constexpr auto operator -=(T t) const -> assignment_t<Base, minus_t<Base, floating_point, wrap_operand_t<T>>>
 						{
 							using rhs = wrap_operand_t<T>;
 							static_assert(_is_valid_operand<rhs>::value, "invalid rhs assignment operand");
@@ -238,7 +279,7 @@ namespace sqlpp
 						}
 
 					template<typename T>
-						auto operator /=(T t) const -> assignment_t<Base, divides_t<Base, wrap_operand_t<T>>>
+						constexpr auto operator /=(T t) const -> assignment_t<Base, divides_t<Base, wrap_operand_t<T>>>
 						{
 							using rhs = wrap_operand_t<T>;
 							static_assert(_is_valid_operand<rhs>::value, "invalid rhs assignment operand");
@@ -247,7 +288,7 @@ namespace sqlpp
 						}
 
 					template<typename T>
-						auto operator *=(T t) const -> assignment_t<Base, multiplies_t<Base, floating_point, wrap_operand_t<T>>>
+						constexpr auto operator *=(T t) const -> assignment_t<Base, multiplies_t<Base, floating_point, wrap_operand_t<T>>>
 						{
 							using rhs = wrap_operand_t<T>;
 							static_assert(_is_valid_operand<rhs>::value, "invalid rhs assignment operand");
@@ -27,6 +27,7 @@
 #ifndef SQLPP_FROM_H
 #define SQLPP_FROM_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/no_data.h>
 #include <sqlpp11/interpretable_list.h>
@@ -41,8 +42,8 @@ namespace sqlpp
 	template<typename Database, typename... Tables>
 		struct from_data_t
 		{
-			from_data_t(Tables... tables):
-				_tables(tables...)
+			constexpr from_data_t(Tables... tables):
+				_tables(std::move(tables)...)
 			{}
 
 			from_data_t(const from_data_t&) = default;
@@ -53,6 +54,11 @@ namespace sqlpp
 
 			std::tuple<Tables...> _tables;
 			interpretable_list_t<Database> _dynamic_tables;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_tables._bind_arena(arena);
+			}
 		};
 
 	// FROM
@@ -109,7 +115,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return from; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.from)
+						static constexpr auto _get_member(T& t) -> decltype((t.from))
 						{
 							return t.from;
 						}
@@ -149,7 +155,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_from; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_from)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_from))
 					{
 						return t.no_from;
 					}
@@ -166,36 +172,52 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Tables>
-					auto from(Tables... tables)
+					constexpr auto from(Tables... tables) const &
 					-> _new_statement_t<from_t<void, Tables...>>
 					{
 						static_assert(sizeof...(Tables), "at least one table or join argument required in from()");
-						return _from_impl<void>(tables...);
+						return _from_impl<void>(*static_cast<const typename Policies::_statement_t*>(this), tables...);
+					}
+
+				template<typename... Tables, typename Statement = typename Policies::_statement_t>
+					auto from(Tables... tables) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<from_t<void, Tables...>>>
+					{
+						static_assert(sizeof...(Tables), "at least one table or join argument required in from()");
+						return _from_impl<void>(std::move(*static_cast<typename Policies::_statement_t*>(this)), tables...);
 					}
 
 				template<typename... Tables>
-					auto dynamic_from(Tables... tables)
+					constexpr auto dynamic_from(Tables... tables) const &
 					-> _new_statement_t<from_t<_database_t, Tables...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_from must not be called in a static statement");
-						return _from_impl<_database_t>(tables...);
+						return _from_impl<_database_t>(*static_cast<const typename Policies::_statement_t*>(this), tables...);
+					}
+
+				template<typename... Tables, typename Statement = typename Policies::_statement_t>
+					auto dynamic_from(Tables... tables) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<from_t<_database_t, Tables...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_from must not be called in a static statement");
+						return _from_impl<_database_t>(std::move(*static_cast<typename Policies::_statement_t*>(this)), tables...);
 					}
 
 			private:
-				template<typename Database, typename... Tables>
-					auto _from_impl(Tables... tables)
+				template<typename Database, typename Statement, typename... Tables>
+					static constexpr auto _from_impl(Statement&& statement, Tables... tables)
 					-> _new_statement_t<from_t<Database, Tables...>>
 					{
 						static_assert(::sqlpp::detail::all_t<is_table_t<Tables>::value...>::value, "at least one argument is not a table or join in from()");
 						static_assert(required_tables_of<from_t<Database, Tables...>>::size::value == 0, "at least one table depends on another table");
 
-						static constexpr std::size_t _number_of_tables = detail::sum(provided_tables_of<Tables>::size::value...);
+						using _number_of_tables = std::integral_constant<std::size_t, detail::sum(provided_tables_of<Tables>::size::value...)>;
 						using _unique_tables = detail::make_joined_set_t<provided_tables_of<Tables>...>;
 						using _unique_table_names = detail::transform_set_t<name_of, _unique_tables>;
-						static_assert(_number_of_tables == _unique_tables::size::value, "at least one duplicate table detected in from()");
-						static_assert(_number_of_tables == _unique_table_names::size::value, "at least one duplicate table name detected in from()");
+						static_assert(_number_of_tables::value == _unique_tables::size::value, "at least one duplicate table detected in from()");
+						static_assert(_number_of_tables::value == _unique_table_names::size::value, "at least one duplicate table name detected in from()");
 
-						return { *static_cast<typename Policies::_statement_t*>(this), from_data_t<Database, Tables...>{tables...} };
+						return { std::forward<Statement>(statement), from_data_t<Database, Tables...>{std::move(tables)...} };
 					}
 
 			};
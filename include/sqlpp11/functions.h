@@ -27,9 +27,13 @@
 #ifndef SQLPP_FUNCTIONS_H
 #define SQLPP_FUNCTIONS_H
 
+#include <functional>
+#include <iterator>
+#include <utility>
 #include <sqlpp11/parameter.h>
 #include <sqlpp11/parameter_list.h>
 #include <sqlpp11/column_types.h>
+#include <sqlpp11/fingerprint.h>
 #include <sqlpp11/in.h>
 #include <sqlpp11/is_null.h>
 #include <sqlpp11/value_type.h>
@@ -57,9 +61,9 @@ namespace sqlpp
 		public alias_operators<verbatim_t<ValueType>>
 	{
 		using _traits = make_traits<ValueType, ::sqlpp::tag::expression>;
-		using _recursive_traits = make_recursive_traits<>;
+		using _recursive_traits = recursive_tags<::sqlpp::tag::contains_runtime_data, ::sqlpp::tag::contains_variable_shape>;
 
-		verbatim_t(std::string verbatim): _verbatim(verbatim) {}
+		verbatim_t(std::string verbatim): _verbatim(std::move(verbatim)) {}
 		verbatim_t(const verbatim_t&) = default;
 		verbatim_t(verbatim_t&&) = default;
 		verbatim_t& operator=(const verbatim_t&) = default;
@@ -84,7 +88,7 @@ namespace sqlpp
 	template<typename ValueType, typename StringType>
 		auto verbatim(StringType s) -> verbatim_t<ValueType>
 		{
-			return { s };
+			return { std::move(s) };
 		}
 
 	template<typename Expression, typename Context>
@@ -96,16 +100,32 @@ namespace sqlpp
 			return { context.str() };
 		}
 
+	// A borrowed range of values, e.g. for value_list(begin, end), the values have to outlive the statement
+	template<typename Iterator>
+		struct value_range_t
+		{
+			using value_type = typename std::iterator_traits<Iterator>::value_type;
+			using const_iterator = Iterator;
+
+			Iterator begin() const { return _begin; }
+			Iterator end() const { return _end; }
+			std::size_t size() const { return static_cast<std::size_t>(std::distance(_begin, _end)); }
+			bool empty() const { return _begin == _end; }
+
+			Iterator _begin;
+			Iterator _end;
+		};
+
 	template<typename Container>
 		struct value_list_t // to be used in .in() method
 		{
 			using _traits = make_traits<value_type_t<typename Container::value_type>, ::sqlpp::tag::expression>;
-			using _recursive_traits = make_recursive_traits<>;
+			using _recursive_traits = recursive_tags<::sqlpp::tag::contains_runtime_data, ::sqlpp::tag::contains_variable_shape>;
 
 			using _container_t = Container;
 
 			value_list_t(_container_t container):
-				_container(container)
+				_container(std::move(container))
 			{}
 
 			value_list_t(const value_list_t&) = default;
@@ -117,6 +137,20 @@ namespace sqlpp
 			_container_t _container;
 		};
 
+	namespace detail
+	{
+		template<typename Iterator, typename Context>
+			void serialize_values(Iterator begin, Iterator end, Context& context)
+			{
+				for (auto it = begin; it != end; ++it)
+				{
+					if (it != begin)
+						context << ',';
+					serialize_operand_value(*it, context);
+				}
+			}
+	}
+
 	template<typename Context, typename Container>
 		struct serializer_t<Context, value_list_t<Container>>
 		{
@@ -124,16 +158,113 @@ namespace sqlpp
 
 			static Context& _(const T& t, Context& context)
 			{
-				bool first = true;
-				for (const auto& entry: t._container)
-				{
-					if (first)
-						first = false;
-					else
-						context << ',';
+				detail::serialize_values(std::begin(t._container), std::end(t._container), context);
+				return context;
+			}
+		};
+
+	namespace detail
+	{
+		// Connectors may limit the number of values in a single IN(...), longer lists are split into OR-ed groups
+		template<typename Context>
+			auto max_in_list_size(const Context& context, int)
+			-> decltype(std::size_t(context._max_in_list_size()))
+			{
+				return context._max_in_list_size();
+			}
+
+		template<typename Context>
+			std::size_t max_in_list_size(const Context&, long)
+			{
+				return 0;
+			}
+
+		template<typename Context>
+			std::size_t max_in_list_size(const Context& context)
+			{
+				return max_in_list_size(context, 0);
+			}
+
+		// Connectors that can bind an array of values serialize the comparison with the whole list themselves, e.g. " = ANY(?)"
+		template<typename Context, typename Container, typename Enable = void>
+			struct can_bind_in_array_t: std::false_type {};
+
+		template<typename Context, typename Container>
+			struct can_bind_in_array_t<Context, Container, decltype(std::declval<Context&>()._in_array(true, std::declval<const Container&>()), void())>: std::true_type {};
+
+		template<bool Inverted, typename Operand, typename Container, typename Context>
+			void serialize_in(const Operand& operand, const Container& container, Context& context, std::true_type)
+			{
+				serialize(operand, context);
+				context._in_array(Inverted, container);
+			}
 
-					serialize(value(entry), context);
+		template<bool Inverted, typename Operand, typename Container, typename Context>
+			void serialize_in(const Operand& operand, const Container& container, Context& context, std::false_type)
+			{
+				const auto begin = std::begin(container);
+				const auto end = std::end(container);
+				std::size_t remaining = static_cast<std::size_t>(std::distance(begin, end));
+				const std::size_t max_size = max_in_list_size(context);
+				const bool chunked = max_size and remaining > max_size;
+				if (chunked)
+					context << '(';
+				auto it = begin;
+				do
+				{
+					const std::size_t chunk_size = chunked and remaining > max_size ? max_size : remaining;
+					auto chunk_end = it;
+					std::advance(chunk_end, chunk_size);
+					if (it != begin)
+						context << (Inverted ? " AND " : " OR ");
+					serialize(operand, context);
+					context << (Inverted ? " NOT IN(" : " IN(");
+					serialize_values(it, chunk_end, context);
+					context << ')';
+					it = chunk_end;
+					remaining -= chunk_size;
 				}
+				while (remaining);
+				if (chunked)
+					context << ')';
+			}
+	}
+
+	template<typename Context, bool NotInverted, typename Operand, typename Container>
+		struct serializer_t<Context, in_t<NotInverted, Operand, value_list_t<Container>>>
+		{
+			using T = in_t<NotInverted, Operand, value_list_t<Container>>;
+
+			static Context& _(const T& t, Context& context)
+			{
+				detail::serialize_in<not NotInverted>(t._operand, std::get<0>(t._args)._container, context, detail::can_bind_in_array_t<Context, Container>{});
+				return context;
+			}
+		};
+
+	// Fingerprints only depend on the number of values, not on their text
+	template<typename Container>
+		struct serializer_t<fingerprint_context_t, value_list_t<Container>>
+		{
+			using T = value_list_t<Container>;
+
+			static fingerprint_context_t& _(const T& t, fingerprint_context_t& context)
+			{
+				context._mix(static_cast<uint64_t>(std::distance(std::begin(t._container), std::end(t._container))));
+				return context;
+			}
+		};
+
+	template<bool NotInverted, typename Operand, typename Container>
+		struct serializer_t<fingerprint_context_t, in_t<NotInverted, Operand, value_list_t<Container>>>
+		{
+			using T = in_t<NotInverted, Operand, value_list_t<Container>>;
+
+			static fingerprint_context_t& _(const T& t, fingerprint_context_t& context)
+			{
+				serialize(t._operand, context);
+				context << (NotInverted ? " IN(" : " NOT IN(");
+				serialize(std::get<0>(t._args), context);
 				return context;
 			}
 		};
@@ -142,7 +273,22 @@ namespace sqlpp
 		auto value_list(Container c) -> value_list_t<Container>
 		{
 			static_assert(is_wrapped_value_t<wrap_operand_t<typename Container::value_type>>::value, "value_list() is to be called with a container of non-sql-type like std::vector<int>, or std::list(string)");
-			return { c };
+			return { std::move(c) };
+		}
+
+	// value_list(std::cref(container)) refers to the container instead of copying it
+	template<typename Container>
+		auto value_list(std::reference_wrapper<Container> c) -> value_list_t<value_range_t<decltype(std::begin(c.get()))>>
+		{
+			static_assert(is_wrapped_value_t<wrap_operand_t<typename Container::value_type>>::value, "value_list() is to be called with a container of non-sql-type like std::vector<int>, or std::list(string)");
+			return { value_range_t<decltype(std::begin(c.get()))>{std::begin(c.get()), std::end(c.get())} };
+		}
+
+	template<typename Iterator>
+		auto value_list(Iterator begin, Iterator end) -> value_list_t<value_range_t<Iterator>>
+		{
+			static_assert(is_wrapped_value_t<wrap_operand_t<typename std::iterator_traits<Iterator>::value_type>>::value, "value_list() is to be called with a range of non-sql-type like int or std::string");
+			return { value_range_t<Iterator>{begin, end} };
 		}
 
 	template<typename T>
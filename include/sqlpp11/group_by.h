@@ -28,6 +28,7 @@
 #define SQLPP_GROUP_BY_H
 
 #include <tuple>
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/expression.h>
 #include <sqlpp11/interpret_tuple.h>
@@ -41,8 +42,8 @@ namespace sqlpp
 	template<typename Database, typename... Expressions>
 		struct group_by_data_t
 		{
-			group_by_data_t(Expressions... expressions):
-				_expressions(expressions...)
+			constexpr group_by_data_t(Expressions... expressions):
+				_expressions(std::move(expressions)...)
 			{}
 
 			group_by_data_t(const group_by_data_t&) = default;
@@ -53,6 +54,11 @@ namespace sqlpp
 
 			std::tuple<Expressions...> _expressions;
 			interpretable_list_t<Database> _dynamic_expressions;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_expressions._bind_arena(arena);
+			}
 		};
 
 	// GROUP BY
@@ -119,7 +125,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return group_by; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.group_by)
+						static constexpr auto _get_member(T& t) -> decltype((t.group_by))
 						{
 							return t.group_by;
 						}
@@ -159,7 +165,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_group_by; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_group_by)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_group_by))
 					{
 						return t.no_group_by;
 					}
@@ -175,18 +181,33 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto group_by(Args... args)
+					constexpr auto group_by(Args... args) const &
 					-> _new_statement_t<group_by_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), group_by_data_t<void, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), group_by_data_t<void, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto group_by(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<group_by_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), group_by_data_t<void, Args...>{std::move(args)...} };
 					}
 
 				template<typename... Args>
-					auto dynamic_group_by(Args... args)
+					constexpr auto dynamic_group_by(Args... args) const &
 					-> _new_statement_t<group_by_t<_database_t, Args...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_group_by must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), group_by_data_t<_database_t, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), group_by_data_t<_database_t, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto dynamic_group_by(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<group_by_t<_database_t, Args...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_group_by must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), group_by_data_t<_database_t, Args...>{std::move(args)...} };
 					}
 			};
 	};
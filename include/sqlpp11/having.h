@@ -27,6 +27,7 @@
 #ifndef SQLPP_HAVING_H
 #define SQLPP_HAVING_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/expression.h>
 #include <sqlpp11/interpret_tuple.h>
@@ -40,8 +41,8 @@ namespace sqlpp
 	template<typename Database, typename... Expressions>
 		struct having_data_t
 		{
-			having_data_t(Expressions... expressions):
-				_expressions(expressions...)
+			constexpr having_data_t(Expressions... expressions):
+				_expressions(std::move(expressions)...)
 			{}
 
 			having_data_t(const having_data_t&) = default;
@@ -52,6 +53,11 @@ namespace sqlpp
 
 			std::tuple<Expressions...> _expressions;
 			interpretable_list_t<Database> _dynamic_expressions;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_expressions._bind_arena(arena);
+			}
 		};
 
 	// HAVING
@@ -116,7 +122,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return having; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.having)
+						static constexpr auto _get_member(T& t) -> decltype((t.having))
 						{
 							return t.having;
 						}
@@ -157,7 +163,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_having; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_having)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_having))
 					{
 						return t.no_having;
 					}
@@ -173,18 +179,33 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto having(Args... args)
+					constexpr auto having(Args... args) const &
 					-> _new_statement_t<having_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), having_data_t<void, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), having_data_t<void, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto having(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<having_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), having_data_t<void, Args...>{std::move(args)...} };
 					}
 
 				template<typename... Args>
-					auto dynamic_having(Args... args)
+					constexpr auto dynamic_having(Args... args) const &
 					-> _new_statement_t<having_t<_database_t, Args...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_having must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), having_data_t<_database_t, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), having_data_t<_database_t, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto dynamic_having(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<having_t<_database_t, Args...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_having must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), having_data_t<_database_t, Args...>{std::move(args)...} };
 					}
 			};
 	};
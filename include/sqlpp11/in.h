@@ -54,9 +54,9 @@ namespace sqlpp
 				};
 		};
 
-		in_t(Operand operand, Args... args):
-			_operand(operand),
-			_args(args...)
+		constexpr in_t(Operand operand, Args... args):
+			_operand(std::move(operand)),
+			_args(std::move(args)...)
 		{}
 
 		in_t(const in_t&) = default;
@@ -70,7 +70,7 @@ namespace sqlpp
 					 {
 						 _statement_t::_check_consistency();
 
-						 return {{}, db.prepare_insert(_get_statement())};
+						 return {{}, _get_statement()._get_dynamic_parameters(), db.prepare_insert(_get_statement()), _get_statement()._get_fingerprint()};
 					 }
 			};
 	};
@@ -120,6 +120,20 @@ namespace sqlpp
 		{
 			return { blank_insert_t<Database>().into(table) };
 		}
+
+	template<typename Database>
+		auto dynamic_insert(const Database&, monotonic_arena_t& arena)
+		-> blank_insert_t<Database>
+		{
+			return { blank_insert_t<Database>(arena) };
+		}
+
+	template<typename Database, typename Table>
+		auto dynamic_insert_into(const Database&, monotonic_arena_t& arena, Table table)
+		-> decltype(blank_insert_t<Database>(arena).into(table))
+		{
+			return { blank_insert_t<Database>(arena).into(table) };
+		}
 }
 
 #endif
@@ -64,25 +64,25 @@ namespace sqlpp
 			using _tvin_t = typename detail::type_if<tvin_t<_wrapped_value_t>, can_be_null_t<Column>::value>::type; // static asserts and SFINAE do not work together
 			using _null_t = typename detail::type_if<null_t, can_be_null_t<Column>::value>::type; // static asserts and SFINAE do not work together
 
-			insert_value_t(assignment_t<Column, _wrapped_value_t> assignment):
+			constexpr insert_value_t(assignment_t<Column, _wrapped_value_t> assignment):
 				_is_null(false),
 				_is_default(false),
 				_value(assignment._rhs)
 			{}
 
-			insert_value_t(assignment_t<Column, _tvin_t> assignment):
+			constexpr insert_value_t(assignment_t<Column, _tvin_t> assignment):
 				_is_null(assignment._rhs._is_trivial()),
 				_is_default(false),
 				_value(assignment._rhs._value)
 			{}
 
-			insert_value_t(const assignment_t<Column, _null_t>&):
+			constexpr insert_value_t(const assignment_t<Column, _null_t>&):
 				_is_null(true),
 				_is_default(false),
 				_value()
 			{}
 
-			insert_value_t(const assignment_t<Column, ::sqlpp::default_value_t>&):
+			constexpr insert_value_t(const assignment_t<Column, ::sqlpp::default_value_t>&):
 				_is_null(false),
 				_is_default(true),
 				_value()
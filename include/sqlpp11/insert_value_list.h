@@ -27,6 +27,7 @@
 #ifndef SQLPP_INSERT_VALUE_LIST_H
 #define SQLPP_INSERT_VALUE_LIST_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/detail/logic.h>
 #include <sqlpp11/assignment.h>
@@ -68,7 +69,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return default_values; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.default_values)
+					static constexpr auto _get_member(T& t) -> decltype((t.default_values))
 					{
 						return t.default_values;
 					}
@@ -84,7 +85,7 @@ namespace sqlpp
 	template<typename Database, typename... Assignments>
 		struct insert_list_data_t
 		{
-			insert_list_data_t(Assignments... assignments):
+			constexpr insert_list_data_t(Assignments... assignments):
 				_assignments(assignments...),
 				_columns({assignments._lhs}...),
 				_values(assignments._rhs...)
@@ -101,6 +102,12 @@ namespace sqlpp
 			std::tuple<typename Assignments::_value_t...> _values;
 			interpretable_list_t<Database> _dynamic_columns;
 			interpretable_list_t<Database> _dynamic_values;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_columns._bind_arena(arena);
+				_dynamic_values._bind_arena(arena);
+			}
 		};
 
 	template<typename Database, typename... Assignments>
@@ -171,7 +178,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return insert_list; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.insert_list)
+						static constexpr auto _get_member(T& t) -> decltype((t.insert_list))
 						{
 							return t.insert_list;
 						}
@@ -208,7 +215,10 @@ namespace sqlpp
 		struct column_list_t
 		{
 			using _traits = make_traits<no_value_t, ::sqlpp::tag::column_list>;
-			using _recursive_traits = make_recursive_traits<Columns...>;
+			struct _recursive_traits: public make_recursive_traits<Columns...>
+			{
+				using _tags = ::sqlpp::detail::type_set<::sqlpp::tag::contains_runtime_data, ::sqlpp::tag::contains_variable_shape>; // the rows are added at runtime
+			};
 
 			static_assert(sizeof...(Columns), "at least one column required in columns()");
 
@@ -268,7 +278,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return values; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.values)
+						static constexpr auto _get_member(T& t) -> decltype((t.values))
 						{
 							return t.values;
 						}
@@ -309,7 +319,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_insert_values; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_insert_values)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_insert_values))
 					{
 						return t.no_insert_values;
 					}
@@ -324,37 +334,67 @@ namespace sqlpp
 
 				static void _check_consistency() {}
 
-				auto default_values()
+				constexpr auto default_values() const &
 					-> _new_statement_t<insert_default_values_t>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), insert_default_values_data_t{} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), insert_default_values_data_t{} };
+					}
+
+				template<typename Statement = typename Policies::_statement_t>
+					auto default_values() &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<insert_default_values_t>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), insert_default_values_data_t{} };
 					}
 
 				template<typename... Args>
-					auto columns(Args... args)
+					constexpr auto columns(Args... args) const &
 					-> _new_statement_t<column_list_t<Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), column_list_data_t<Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), column_list_data_t<Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto columns(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<column_list_t<Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), column_list_data_t<Args...>{std::move(args)...} };
 					}
 
 				template<typename... Assignments>
-					auto set(Assignments... assignments)
+					constexpr auto set(Assignments... assignments) const &
 					-> _new_statement_t<insert_list_t<void, Assignments...>>
 					{
 						static_assert(sizeof...(Assignments), "at least one assignment expression required in set()");
-						return _set_impl<void>(assignments...);
+						return _set_impl<void>(*static_cast<const typename Policies::_statement_t*>(this), assignments...);
+					}
+
+				template<typename... Assignments, typename Statement = typename Policies::_statement_t>
+					auto set(Assignments... assignments) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<insert_list_t<void, Assignments...>>>
+					{
+						static_assert(sizeof...(Assignments), "at least one assignment expression required in set()");
+						return _set_impl<void>(std::move(*static_cast<typename Policies::_statement_t*>(this)), assignments...);
 					}
 
 				template<typename... Assignments>
-					auto dynamic_set(Assignments... assignments)
+					constexpr auto dynamic_set(Assignments... assignments) const &
 					-> _new_statement_t<insert_list_t<_database_t, Assignments...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_set must not be called in a static statement");
-						return _set_impl<_database_t>(assignments...);
+						return _set_impl<_database_t>(*static_cast<const typename Policies::_statement_t*>(this), assignments...);
+					}
+
+				template<typename... Assignments, typename Statement = typename Policies::_statement_t>
+					auto dynamic_set(Assignments... assignments) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<insert_list_t<_database_t, Assignments...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_set must not be called in a static statement");
+						return _set_impl<_database_t>(std::move(*static_cast<typename Policies::_statement_t*>(this)), assignments...);
 					}
 			private:
-				template<typename Database, typename... Assignments>
-					auto _set_impl(Assignments... assignments)
+				template<typename Database, typename Statement, typename... Assignments>
+					static constexpr auto _set_impl(Statement&& statement, Assignments... assignments)
 					-> _new_statement_t<insert_list_t<Database, Assignments...>>
 					{
 						static_assert(not ::sqlpp::detail::has_duplicates<Assignments...>::value, "at least one duplicate argument detected in set()");
@@ -364,7 +404,7 @@ namespace sqlpp
 						using _column_required_tables = typename ::sqlpp::detail::make_joined_set<required_tables_of<typename Assignments::_column_t>...>::type;
 						static_assert(sizeof...(Assignments) ? (_column_required_tables::size::value == 1) : true, "set() contains assignments for columns from several tables");
 
-						return { *static_cast<typename Policies::_statement_t*>(this), insert_list_data_t<Database, Assignments...>{assignments...} };
+						return { std::forward<Statement>(statement), insert_list_data_t<Database, Assignments...>{std::move(assignments)...} };
 					}
 			};
 	};
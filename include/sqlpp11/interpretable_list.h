@@ -27,15 +27,15 @@
 #ifndef SQLPP_INTERPRETABLE_LIST_H
 #define SQLPP_INTERPRETABLE_LIST_H
 
-#include <vector>
 #include <sqlpp11/interpretable.h>
+#include <sqlpp11/monotonic_arena.h>
 
 namespace sqlpp
 {
 	template<typename Db>
 		struct interpretable_list_t
 		{
-			std::vector<interpretable_t<Db>> _serializables;
+			detail::arena_vector_t<interpretable_t<Db>> _serializables;
 
 			std::size_t size() const
 			{
@@ -53,6 +53,10 @@ namespace sqlpp
 					_serializables.emplace_back(expr);
 				}
 
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				detail::bind_arena(_serializables, arena);
+			}
 		};
 
 	template<>
@@ -68,6 +72,8 @@ namespace sqlpp
 				return true;
 			}
 
+			void _bind_arena(monotonic_arena_t*)
+			{}
 		};
 
 	template<typename Context, typename List>
@@ -78,15 +84,16 @@ namespace sqlpp
 			template<typename Separator>
 				static Context& _(const T& t, const Separator& separator, Context& context)
 				{
-					bool first = true;
-					for (const auto entry : t._serializables)
+					// The separator goes between the entries, e.g. "a AND b", not "(a)(b)"
+					auto it = t._serializables.begin();
+					const auto end = t._serializables.end();
+					if (it == end)
+						return context;
+					serialize(*it, context);
+					for (++it; it != end; ++it)
 					{
-						if (not first)
-						{
-							context << separator;
-							first = false;
-						}
-						serialize(entry, context);
+						context << separator;
+						serialize(*it, context);
 					}
 					return context;
 				}
@@ -27,6 +27,7 @@
 #ifndef SQLPP_INTO_H
 #define SQLPP_INTO_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/no_value.h>
 #include <sqlpp11/no_data.h>
@@ -40,7 +41,7 @@ namespace sqlpp
 	template<typename Database, typename Table>
 		struct into_data_t
 		{
-			into_data_t(Table table):
+			constexpr into_data_t(Table table):
 				_table(table)
 			{}
 
@@ -85,7 +86,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return into; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.into)
+						static constexpr auto _get_member(T& t) -> decltype((t.into))
 						{
 							return t.into;
 						}
@@ -127,7 +128,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_into; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_into)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_into))
 					{
 						return t.no_into;
 					}
@@ -146,10 +147,17 @@ namespace sqlpp
 					}
 
 				template<typename... Args>
-					auto into(Args... args)
+					constexpr auto into(Args... args) const &
 					-> _new_statement_t<into_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), into_data_t<void, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), into_data_t<void, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto into(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<into_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), into_data_t<void, Args...>{std::move(args)...} };
 					}
 			};
 	};
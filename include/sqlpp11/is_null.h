@@ -57,7 +57,7 @@ namespace sqlpp
 				};
 		};
 
-		is_null_t(Operand operand):
+		constexpr is_null_t(Operand operand):
 			_operand(operand)
 		{}
 
@@ -93,7 +93,7 @@ namespace sqlpp
 				using set_on_t = join_t<JoinType, Lhs, Rhs, OnT>;
 
 			template<typename... Expr>
-				auto on(Expr... expr)
+				constexpr auto on(Expr... expr) const
 				-> set_on_t<on_t<void, Expr...>>
 				{
 					static_assert(is_noop<On>::value, "cannot call on() twice for a single join()");
@@ -104,35 +104,35 @@ namespace sqlpp
 				}
 
 			template<typename T>
-				join_t<inner_join_t, join_t, T> join(T t)
+				constexpr join_t<inner_join_t, join_t, T> join(T t) const
 				{
 					static_assert(not is_noop<On>::value, "join type requires on()");
 					return { *this, t };
 				}
 
 			template<typename T>
-				join_t<inner_join_t, join_t, T> inner_join(T t)
+				constexpr join_t<inner_join_t, join_t, T> inner_join(T t) const
 				{
 					static_assert(not is_noop<On>::value, "join type requires on()");
 					return { *this, t };
 				}
 
 			template<typename T>
-				join_t<outer_join_t, join_t, T> outer_join(T t)
+				constexpr join_t<outer_join_t, join_t, T> outer_join(T t) const
 				{
 					static_assert(not is_noop<On>::value, "join type requires on()");
 					return { *this, t };
 				}
 
 			template<typename T>
-				join_t<left_outer_join_t, join_t, T> left_outer_join(T t)
+				constexpr join_t<left_outer_join_t, join_t, T> left_outer_join(T t) const
 				{
 					static_assert(not is_noop<On>::value, "join type requires on()");
 					return { *this, t };
 				}
 
 			template<typename T>
-				join_t<right_outer_join_t, join_t, T> right_outer_join(T t)
+				constexpr join_t<right_outer_join_t, join_t, T> right_outer_join(T t) const
 				{
 					static_assert(not is_noop<On>::value, "join type requires on()");
 					return { *this, t };
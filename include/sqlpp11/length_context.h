@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_LENGTH_CONTEXT_H
+#define SQLPP_LENGTH_CONTEXT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <sqlpp11/serialize.h>
+#include <sqlpp11/detail/number_format.h>
+
+namespace sqlpp
+{
+	// A context that does not produce text, but sums up the length of what would be serialized.
+	// Numbers are counted with their maximum length, so the result is an upper bound for
+	// contexts that use the default serializers.
+	struct length_context_t
+	{
+		std::size_t _length = 0;
+		// Clean spans of text values at least this long are not counted, see segmented_context_t
+		std::size_t _borrow_threshold = static_cast<std::size_t>(-1);
+
+		template<typename T>
+			length_context_t& operator<<(const T& t)
+			{
+				append(t);
+				return *this;
+			}
+
+		length_context_t& operator<<(const char* s)
+		{
+			append(s);
+			return *this;
+		}
+
+		void append(char)
+		{
+			++_length;
+		}
+
+		void append(const char* s)
+		{
+			_length += std::strlen(s);
+		}
+
+		void append(const char*, std::size_t len)
+		{
+			_length += len;
+		}
+
+		void append(const std::string& s)
+		{
+			_length += s.size();
+		}
+
+		void append(bool)
+		{
+			++_length;
+		}
+
+		template<typename T>
+			auto append(T)
+			-> typename std::enable_if<std::is_integral<T>::value, void>::type
+			{
+				_length += detail::max_integral_length;
+			}
+
+		template<typename T>
+			auto append(T)
+			-> typename std::enable_if<std::is_floating_point<T>::value, void>::type
+			{
+				_length += detail::max_floating_point_length;
+			}
+
+		void append_escaped(const char* s, std::size_t len)
+		{
+			const char* const end = s + len;
+			if (len < _borrow_threshold)
+			{
+				_length += len;
+				while (const char* quote = static_cast<const char*>(std::memchr(s, '\'', static_cast<std::size_t>(end - s))))
+				{
+					++_length;
+					s = quote + 1;
+				}
+				return;
+			}
+
+			while (s != end)
+			{
+				const char* quote = static_cast<const char*>(std::memchr(s, '\'', static_cast<std::size_t>(end - s)));
+				const char* span_end = quote ? quote : end;
+				const std::size_t span_length = static_cast<std::size_t>(span_end - s);
+				if (span_length < _borrow_threshold)
+					_length += span_length;
+				if (not quote)
+					break;
+				_length += 2;
+				s = quote + 1;
+			}
+		}
+
+		void append_escaped(const std::string& s)
+		{
+			append_escaped(s.data(), s.size());
+		}
+	};
+
+	template<typename T>
+		std::size_t serialized_length(const T& t)
+		{
+			length_context_t context;
+			serialize(t, context);
+			return context._length;
+		}
+
+	namespace detail
+	{
+		// Contexts that refer to large text values instead of copying them do not need room for them
+		template<typename Context>
+			auto borrow_threshold(const Context& context, int)
+			-> decltype(std::size_t(context._borrow_threshold))
+			{
+				return context._borrow_threshold;
+			}
+
+		template<typename Context>
+			std::size_t borrow_threshold(const Context&, long)
+			{
+				return static_cast<std::size_t>(-1);
+			}
+
+		// Text that only exists while it is serialized (e.g. a std::string converted from a const char*)
+		// must not be referenced by contexts that borrow large text values, so borrowing is switched off meanwhile
+		template<typename Context, typename Enable = void>
+			struct temporary_text_guard_t
+			{
+				explicit temporary_text_guard_t(Context&) {}
+			};
+
+		template<typename Context>
+			struct temporary_text_guard_t<Context, decltype(void(std::size_t(std::declval<Context&>()._borrow_threshold)))>
+			{
+				explicit temporary_text_guard_t(Context& context):
+					_context(context),
+					_borrow_threshold(context._borrow_threshold)
+				{
+					context._borrow_threshold = static_cast<std::size_t>(-1);
+				}
+
+				temporary_text_guard_t(const temporary_text_guard_t&) = delete;
+				temporary_text_guard_t& operator=(const temporary_text_guard_t&) = delete;
+
+				~temporary_text_guard_t()
+				{
+					_context._borrow_threshold = _borrow_threshold;
+				}
+
+				Context& _context;
+				std::size_t _borrow_threshold;
+			};
+
+		// The length of the most recent serialization of a statement type, unknown before the first one
+		template<typename T>
+			struct serialized_length_hint_t
+			{
+				static std::atomic<std::size_t> _length;
+			};
+
+		template<typename T>
+			std::atomic<std::size_t> serialized_length_hint_t<T>::_length{static_cast<std::size_t>(-1)};
+
+		// Contexts that can reserve space are sized once before a statement is serialized into them.
+		// Walking the statement for its length costs about as much as serializing it, so the walk is skipped
+		// if the previous statement of the same type fit into the context as it is (e.g. its inline buffer).
+		// Nested statements (e.g. sub selects) find a non-empty context and leave it alone.
+		// Returns true if the caller is expected to remember the length, see remember_serialized_length().
+		template<typename T, typename Context>
+			auto reserve_serialized_length(const T& t, Context& context, int)
+			-> decltype(context.reserve(std::size_t{}), void(context.empty()), std::size_t(context.capacity()), std::size_t(context.size()), bool())
+			{
+				if (not context.empty())
+					return false;
+				if (serialized_length_hint_t<T>::_length.load(std::memory_order_relaxed) > context.capacity())
+				{
+					length_context_t length_context;
+					length_context._borrow_threshold = borrow_threshold(context, 0);
+					serialize(t, length_context);
+					context.reserve(length_context._length);
+				}
+				return true;
+			}
+
+		template<typename T, typename Context>
+			bool reserve_serialized_length(const T&, Context&, long)
+			{
+				return false;
+			}
+
+		template<typename T, typename Context>
+			auto remember_serialized_length(const Context& context, int)
+			-> decltype(std::size_t(context.size()), void())
+			{
+				serialized_length_hint_t<T>::_length.store(context.size(), std::memory_order_relaxed);
+			}
+
+		template<typename T, typename Context>
+			void remember_serialized_length(const Context&, long)
+			{
+			}
+
+		template<typename T, typename Context>
+			void remember_serialized_length(const Context& context)
+			{
+				remember_serialized_length<T>(context, 0);
+			}
+
+		template<typename T, typename Context>
+			bool reserve_serialized_length(const T& t, Context& context)
+			{
+				return reserve_serialized_length(t, context, 0);
+			}
+	}
+}
+
+#endif
@@ -53,7 +53,7 @@ namespace sqlpp
 				};
 		};
 
-		like_t(Operand operand, Pattern pattern):
+		constexpr like_t(Operand operand, Pattern pattern):
 			_operand(operand),
 			_pattern(pattern)
 		{}
@@ -27,6 +27,7 @@
 #ifndef SQLPP_LIMIT_H
 #define SQLPP_LIMIT_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/policy_update.h>
 #include <sqlpp11/detail/type_set.h>
@@ -37,7 +38,7 @@ namespace sqlpp
 	template<typename Limit>
 		struct limit_data_t
 		{
-			limit_data_t(Limit value):
+			constexpr limit_data_t(Limit value):
 				_value(value)
 			{}
 
@@ -80,7 +81,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return limit; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.limit)
+						static constexpr auto _get_member(T& t) -> decltype((t.limit))
 						{
 							return t.limit;
 						}
@@ -156,7 +157,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return limit; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.limit)
+						static constexpr auto _get_member(T& t) -> decltype((t.limit))
 						{
 							return t.limit;
 						}
@@ -196,7 +197,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_limit; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_limit)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_limit))
 					{
 						return t.no_limit;
 					}
@@ -212,17 +213,32 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename Arg>
-					auto limit(Arg arg)
+					constexpr auto limit(Arg arg) const &
 					-> _new_statement_t<limit_t<typename wrap_operand<Arg>::type>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), limit_data_t<typename wrap_operand<Arg>::type>{{arg}} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), limit_data_t<typename wrap_operand<Arg>::type>{{arg}} };
 					}
 
-				auto dynamic_limit()
+				template<typename Arg, typename Statement = typename Policies::_statement_t>
+					auto limit(Arg arg) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<limit_t<typename wrap_operand<Arg>::type>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), limit_data_t<typename wrap_operand<Arg>::type>{{arg}} };
+					}
+
+				constexpr auto dynamic_limit() const &
 					-> _new_statement_t<dynamic_limit_t<_database_t>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_limit must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), dynamic_limit_data_t<_database_t>{} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), dynamic_limit_data_t<_database_t>{} };
+					}
+
+				template<typename Statement = typename Policies::_statement_t>
+					auto dynamic_limit() &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<dynamic_limit_t<_database_t>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_limit must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), dynamic_limit_data_t<_database_t>{} };
 					}
 			};
 	};
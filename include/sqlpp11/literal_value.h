@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_LITERAL_VALUE_H
+#define SQLPP_LITERAL_VALUE_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sqlpp
+{
+	// The value of a literal that was replaced by a placeholder during serialization, see serializer_context_t::auto_parameterize()
+	struct literal_value_t
+	{
+		enum class type_t
+		{
+			boolean,
+			integral,
+			floating_point,
+			text
+		};
+
+		literal_value_t(bool value):
+			_type(type_t::boolean),
+			_integral(value),
+			_floating_point(0)
+		{}
+
+		literal_value_t(int64_t value):
+			_type(type_t::integral),
+			_integral(value),
+			_floating_point(0)
+		{}
+
+		literal_value_t(double value):
+			_type(type_t::floating_point),
+			_integral(0),
+			_floating_point(value)
+		{}
+
+		literal_value_t(std::string value):
+			_type(type_t::text),
+			_integral(0),
+			_floating_point(0),
+			_text(std::move(value))
+		{}
+
+		literal_value_t(const literal_value_t&) = default;
+		literal_value_t(literal_value_t&&) = default;
+		literal_value_t& operator=(const literal_value_t&) = default;
+		literal_value_t& operator=(literal_value_t&&) = default;
+		~literal_value_t() = default;
+
+		type_t _type;
+		int64_t _integral; // also used for boolean values
+		double _floating_point;
+		std::string _text;
+
+		bool operator==(const literal_value_t& rhs) const
+		{
+			return _type == rhs._type and _integral == rhs._integral and _floating_point == rhs._floating_point and _text == rhs._text;
+		}
+
+		bool operator!=(const literal_value_t& rhs) const
+		{
+			return not operator==(rhs);
+		}
+	};
+
+	using literal_values_t = std::vector<literal_value_t>;
+}
+
+#endif
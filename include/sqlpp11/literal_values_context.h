@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_LITERAL_VALUES_CONTEXT_H
+#define SQLPP_LITERAL_VALUES_CONTEXT_H
+
+#include <sqlpp11/literal_value.h>
+#include <sqlpp11/serialize.h>
+
+namespace sqlpp
+{
+	// A context that does not produce text, but collects the literal values of an expression in the order
+	// in which serializer_context_t::auto_parameterize() would replace them by placeholders.
+	struct literal_values_context_t
+	{
+		literal_values_t& _values;
+
+		explicit literal_values_context_t(literal_values_t& values):
+			_values(values)
+		{}
+
+		template<typename T>
+			literal_values_context_t& operator<<(const T&)
+			{
+				return *this;
+			}
+
+		// Taking the pointer by value avoids odr-using static constexpr names like op::plus::_name
+		literal_values_context_t& operator<<(const char*)
+		{
+			return *this;
+		}
+
+		template<typename... T>
+			void append(const T&...)
+			{
+			}
+
+		template<typename... T>
+			void append_escaped(const T&...)
+			{
+			}
+
+		template<typename T>
+			bool _parameterize_literal(const T& value)
+			{
+				_values.emplace_back(value);
+				return true;
+			}
+	};
+
+	template<typename T>
+		literal_values_t literal_values_of(const T& t)
+		{
+			literal_values_t values;
+			literal_values_context_t context(values);
+			serialize(t, context);
+			return values;
+		}
+}
+
+#endif
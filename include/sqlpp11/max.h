@@ -52,7 +52,7 @@ namespace sqlpp
 				};
 		};
 
-		max_t(Expr expr):
+		constexpr max_t(Expr expr):
 			_expr(expr)
 		{}
 
@@ -80,7 +80,7 @@ namespace sqlpp
 		};
 
 	template<typename T>
-		auto max(T t) -> max_t<wrap_operand_t<T>>
+		constexpr auto max(T t) -> max_t<wrap_operand_t<T>>
 		{
 			static_assert(is_expression_t<wrap_operand_t<T>>::value, "max() requires a value expression as argument");
 			return { t };
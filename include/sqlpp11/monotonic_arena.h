@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_MONOTONIC_ARENA_H
+#define SQLPP_MONOTONIC_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace sqlpp
+{
+	// Memory for the dynamic parts of statements, e.g.
+	//
+	//   sqlpp::monotonic_arena_t arena;
+	//   auto s = dynamic_select(db, arena, t.alpha).from(t).dynamic_where();
+	//   s.where.add(t.beta == "cheesecake"); // stored in the arena
+	//
+	// The arena hands out memory from blocks of growing size. Memory is never returned to the arena
+	// individually, all blocks are freed at once when the arena is destroyed (or released).
+	// The arena therefore has to outlive all statements built with it (including copies of these statements).
+	class monotonic_arena_t
+	{
+		struct block_t
+		{
+			block_t* _next;
+		};
+
+		static constexpr std::size_t _header_size = (sizeof(block_t) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+		block_t* _blocks = nullptr;
+		char* _current = nullptr;
+		char* _end = nullptr;
+		std::size_t _next_block_size;
+		std::size_t _no_of_blocks = 0;
+
+		void _add_block(std::size_t min_size)
+		{
+			while (_next_block_size < min_size)
+				_next_block_size *= 2;
+			auto block = static_cast<block_t*>(::operator new(_header_size + _next_block_size));
+			block->_next = _blocks;
+			_blocks = block;
+			_current = reinterpret_cast<char*>(block) + _header_size;
+			_end = _current + _next_block_size;
+			_next_block_size *= 2;
+			++_no_of_blocks;
+		}
+
+	public:
+		static constexpr std::size_t _default_block_size = 4096;
+
+		explicit monotonic_arena_t(std::size_t block_size = _default_block_size):
+			_next_block_size(block_size ? block_size : 1)
+		{}
+
+		monotonic_arena_t(const monotonic_arena_t&) = delete;
+		monotonic_arena_t(monotonic_arena_t&&) = delete;
+		monotonic_arena_t& operator=(const monotonic_arena_t&) = delete;
+		monotonic_arena_t& operator=(monotonic_arena_t&&) = delete;
+
+		~monotonic_arena_t()
+		{
+			release();
+		}
+
+		void* allocate(std::size_t size, std::size_t alignment)
+		{
+			auto offset = (alignment - reinterpret_cast<std::uintptr_t>(_current) % alignment) % alignment;
+			if (not _current or static_cast<std::size_t>(_end - _current) < offset + size)
+			{
+				_add_block(size + alignment);
+				offset = (alignment - reinterpret_cast<std::uintptr_t>(_current) % alignment) % alignment;
+			}
+			auto result = _current + offset;
+			_current = result + size;
+			return result;
+		}
+
+		// Frees all memory at once. Nothing allocated from the arena may be used afterwards.
+		void release()
+		{
+			while (_blocks)
+			{
+				auto next = _blocks->_next;
+				::operator delete(_blocks);
+				_blocks = next;
+			}
+			_current = nullptr;
+			_end = nullptr;
+		}
+
+		std::size_t _get_no_of_blocks() const
+		{
+			return _no_of_blocks;
+		}
+	};
+
+	namespace detail
+	{
+		// Allocates from an arena, or from the heap, if there is no arena.
+		// Containers hand their arena on to copies and to the targets of assignments.
+		template<typename T>
+			struct arena_allocator_t
+			{
+				using value_type = T;
+				using propagate_on_container_copy_assignment = std::true_type;
+				using propagate_on_container_move_assignment = std::true_type;
+				using propagate_on_container_swap = std::true_type;
+
+				monotonic_arena_t* _arena;
+
+				arena_allocator_t(monotonic_arena_t* arena = nullptr) noexcept:
+					_arena(arena)
+				{}
+
+				template<typename U>
+					arena_allocator_t(const arena_allocator_t<U>& rhs) noexcept:
+						_arena(rhs._arena)
+				{}
+
+				T* allocate(std::size_t n)
+				{
+					return static_cast<T*>(_arena ? _arena->allocate(n * sizeof(T), alignof(T)) : ::operator new(n * sizeof(T)));
+				}
+
+				void deallocate(T* p, std::size_t)
+				{
+					if (not _arena)
+						::operator delete(p);
+				}
+			};
+
+		template<typename T, typename U>
+			bool operator==(const arena_allocator_t<T>& lhs, const arena_allocator_t<U>& rhs)
+			{
+				return lhs._arena == rhs._arena;
+			}
+
+		template<typename T, typename U>
+			bool operator!=(const arena_allocator_t<T>& lhs, const arena_allocator_t<U>& rhs)
+			{
+				return lhs._arena != rhs._arena;
+			}
+
+		template<typename T>
+			using arena_vector_t = std::vector<T, arena_allocator_t<T>>;
+
+		// Moves the elements of the vector into memory from the arena (unless they are there already)
+		template<typename T>
+			void bind_arena(arena_vector_t<T>& vector, monotonic_arena_t* arena)
+			{
+				if (vector.get_allocator()._arena == arena)
+					return;
+				arena_vector_t<T> bound(arena);
+				bound.reserve(vector.size());
+				for (auto& element : vector)
+					bound.push_back(std::move(element));
+				vector = std::move(bound);
+			}
+	}
+}
+
+#endif
@@ -46,11 +46,11 @@ namespace sqlpp
 
 			static_assert(detail::all_t<is_named_expression_t<Columns>::value...>::value, "multi_column parameters need to be named expressions");
 
-			multi_column_t(std::tuple<Columns...> columns):
+			constexpr multi_column_t(std::tuple<Columns...> columns):
 				_columns(columns)
 			{}
 
-			multi_column_t(Columns... columns):
+			constexpr multi_column_t(Columns... columns):
 				_columns(columns...)
 			{}
 
@@ -83,15 +83,15 @@ namespace sqlpp
 
 			using _name_t = typename AliasProvider::_name_t;
 
-			multi_column_alias_t(multi_column_t<void, Columns...> multi_column):
+			constexpr multi_column_alias_t(multi_column_t<void, Columns...> multi_column):
 				_columns(multi_column._columns)
 			{}
 
-			multi_column_alias_t(std::tuple<Columns...> columns):
+			constexpr multi_column_alias_t(std::tuple<Columns...> columns):
 				_columns(columns)
 			{}
 
-			multi_column_alias_t(Columns... columns):
+			constexpr multi_column_alias_t(Columns... columns):
 				_columns(columns...)
 			{}
 
@@ -27,9 +27,13 @@
 #ifndef SQLPP_NAMED_SERIALIZABLE_H
 #define SQLPP_NAMED_SERIALIZABLE_H
 
-#include <memory>
+#include <utility>
 #include <sqlpp11/serializer_context.h>
-#include <sqlpp11/parameter_list.h>
+#include <sqlpp11/length_context.h>
+#include <sqlpp11/fingerprint.h>
+#include <sqlpp11/dynamic_parameter_list.h>
+#include <sqlpp11/literal_values_context.h>
+#include <sqlpp11/detail/small_buffer.h>
 
 namespace sqlpp
 {
@@ -39,9 +43,12 @@ namespace sqlpp
 			using _serializer_context_t = typename Db::_serializer_context_t;
 			using _interpreter_context_t = typename Db::_interpreter_context_t;
 
+			// Expressions of up to this size (including a vtable pointer) are stored inline, larger ones on the heap
+			static constexpr std::size_t _inline_size = 8 * sizeof(void*);
+
 			template<typename T>
 				named_interpretable_t(T t):
-					_impl(std::make_shared<_impl_t<T>>(t))
+					_impl(_storage_t::template create<_impl_t<T>>(std::move(t)))
 			{}
 
 			named_interpretable_t(const named_interpretable_t&) = default;
@@ -69,26 +76,49 @@ namespace sqlpp
 				return _impl->interpret(context);
 			}
 
+			std::size_t serialized_length() const
+			{
+				return _impl->serialized_length();
+			}
+
+			uint64_t fingerprint() const
+			{
+				return _impl->fingerprint();
+			}
+
+			void index_parameters(parameter_index_context_t& context) const
+			{
+				_impl->index_parameters(context);
+			}
+
+			void collect_literal_values(literal_values_context_t& context) const
+			{
+				_impl->collect_literal_values(context);
+			}
+
 			std::string _get_name() const
 			{
 				return _impl->_get_name();
 			}
 
 		private:
-			struct _impl_base
+			struct _impl_base: public detail::small_buffer_base_t
 			{
 				virtual sqlpp::serializer_context_t& serialize(sqlpp::serializer_context_t& context) const = 0;
 				virtual _serializer_context_t& db_serialize(_serializer_context_t& context) const = 0;
 				virtual _interpreter_context_t& interpret(_interpreter_context_t& context) const = 0;
+				virtual std::size_t serialized_length() const = 0;
+				virtual uint64_t fingerprint() const = 0;
+				virtual void index_parameters(parameter_index_context_t& context) const = 0;
+				virtual void collect_literal_values(literal_values_context_t& context) const = 0;
 				virtual std::string _get_name() const = 0;
 			};
 
 			template<typename T>
-				struct _impl_t: public _impl_base
+				struct _impl_t: public detail::small_buffer_impl_t<_impl_base, _impl_t<T>, _inline_size>
 			{
-				static_assert(not make_parameter_list_t<T>::size::value, "parameters not supported in dynamic statement parts");
 				_impl_t(T t):
-					_t(t)
+					_t(std::move(t))
 				{}
 
 				sqlpp::serializer_context_t& serialize(sqlpp::serializer_context_t& context) const
@@ -109,6 +139,44 @@ namespace sqlpp
 					return context;
 				}
 
+				std::size_t serialized_length() const
+				{
+					return sqlpp::serialized_length(_t);
+				}
+
+				uint64_t fingerprint() const
+				{
+					return sqlpp::fingerprint(_t);
+				}
+
+				void index_parameters(parameter_index_context_t& context) const
+				{
+					index_parameters(context, std::integral_constant<bool, std::tuple_size<parameters_of<T>>::value != 0>{});
+				}
+
+				void index_parameters(parameter_index_context_t& context, const std::true_type&) const
+				{
+					detail::index_dynamic_parameters(_t, context);
+				}
+
+				void index_parameters(parameter_index_context_t&, const std::false_type&) const
+				{
+				}
+
+				void collect_literal_values(literal_values_context_t& context) const
+				{
+					collect_literal_values(context, std::integral_constant<bool, contains_runtime_data_t<T>::value>{});
+				}
+
+				void collect_literal_values(literal_values_context_t& context, const std::true_type&) const
+				{
+					sqlpp::serialize(_t, context);
+				}
+
+				void collect_literal_values(literal_values_context_t&, const std::false_type&) const
+				{
+				}
+
 				std::string _get_name() const
 				{
 					return T::_name_t::_get_name();
@@ -117,7 +185,8 @@ namespace sqlpp
 				T _t;
 			};
 
-			std::shared_ptr<const _impl_base> _impl;
+			using _storage_t = detail::small_buffer_t<_impl_base, _inline_size>;
+			_storage_t _impl;
 		};
 
 	template<typename Context, typename Database>
@@ -132,6 +201,54 @@ namespace sqlpp
 			}
 		};
 
+	template<typename Database>
+		struct serializer_t<length_context_t, named_interpretable_t<Database>>
+		{
+			using T = named_interpretable_t<Database>;
+
+			static length_context_t& _(const T& t, length_context_t& context)
+			{
+				context._length += t.serialized_length();
+				return context;
+			}
+		};
+
+	template<typename Database>
+		struct serializer_t<fingerprint_context_t, named_interpretable_t<Database>>
+		{
+			using T = named_interpretable_t<Database>;
+
+			static fingerprint_context_t& _(const T& t, fingerprint_context_t& context)
+			{
+				context._mix(t.fingerprint());
+				return context;
+			}
+		};
+
+	template<typename Database>
+		struct serializer_t<literal_values_context_t, named_interpretable_t<Database>>
+		{
+			using T = named_interpretable_t<Database>;
+
+			static literal_values_context_t& _(const T& t, literal_values_context_t& context)
+			{
+				t.collect_literal_values(context);
+				return context;
+			}
+		};
+
+	template<typename Database>
+		struct serializer_t<parameter_index_context_t, named_interpretable_t<Database>>
+		{
+			using T = named_interpretable_t<Database>;
+
+			static parameter_index_context_t& _(const T& t, parameter_index_context_t& context)
+			{
+				t.index_parameters(context);
+				return context;
+			}
+		};
+
 }
 
 #endif
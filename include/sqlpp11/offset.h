@@ -27,6 +27,7 @@
 #ifndef SQLPP_OFFSET_H
 #define SQLPP_OFFSET_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/policy_update.h>
 #include <sqlpp11/detail/type_set.h>
@@ -37,7 +38,7 @@ namespace sqlpp
 	template<typename Offset>
 		struct offset_data_t
 		{
-			offset_data_t(Offset value):
+			constexpr offset_data_t(Offset value):
 				_value(value)
 			{}
 
@@ -80,7 +81,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return offset; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.offset)
+						static constexpr auto _get_member(T& t) -> decltype((t.offset))
 						{
 							return t.offset;
 						}
@@ -156,7 +157,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return offset; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.offset)
+						static constexpr auto _get_member(T& t) -> decltype((t.offset))
 						{
 							return t.offset;
 						}
@@ -207,7 +208,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_offset; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_offset)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_offset))
 					{
 						return t.no_offset;
 					}
@@ -223,17 +224,32 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename Arg>
-					auto offset(Arg arg)
+					constexpr auto offset(Arg arg) const &
 					-> _new_statement_t<offset_t<typename wrap_operand<Arg>::type>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), offset_data_t<typename wrap_operand<Arg>::type>{{arg}} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), offset_data_t<typename wrap_operand<Arg>::type>{{arg}} };
 					}
 
-				auto dynamic_offset()
+				template<typename Arg, typename Statement = typename Policies::_statement_t>
+					auto offset(Arg arg) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<offset_t<typename wrap_operand<Arg>::type>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), offset_data_t<typename wrap_operand<Arg>::type>{{arg}} };
+					}
+
+				constexpr auto dynamic_offset() const &
 					-> _new_statement_t<dynamic_offset_t<_database_t>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_offset must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), dynamic_offset_data_t<_database_t>{} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), dynamic_offset_data_t<_database_t>{} };
+					}
+
+				template<typename Statement = typename Policies::_statement_t>
+					auto dynamic_offset() &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<dynamic_offset_t<_database_t>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_offset must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), dynamic_offset_data_t<_database_t>{} };
 					}
 			};
 	};
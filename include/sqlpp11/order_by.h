@@ -28,6 +28,7 @@
 #define SQLPP_ORDER_BY_H
 
 #include <tuple>
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/interpret_tuple.h>
 #include <sqlpp11/interpretable.h>
@@ -41,8 +42,8 @@ namespace sqlpp
 	template<typename Database, typename... Expressions>
 		struct order_by_data_t
 		{
-			order_by_data_t(Expressions... expressions):
-				_expressions(expressions...)
+			constexpr order_by_data_t(Expressions... expressions):
+				_expressions(std::move(expressions)...)
 			{}
 
 			order_by_data_t(const order_by_data_t&) = default;
@@ -53,6 +54,11 @@ namespace sqlpp
 
 			std::tuple<Expressions...> _expressions;
 			interpretable_list_t<Database> _dynamic_expressions;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_expressions._bind_arena(arena);
+			}
 		};
 
 	// ORDER BY
@@ -119,7 +125,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return order_by; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.order_by)
+						static constexpr auto _get_member(T& t) -> decltype((t.order_by))
 						{
 							return t.order_by;
 						}
@@ -159,7 +165,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_order_by; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_order_by)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_order_by))
 					{
 						return t.no_order_by;
 					}
@@ -175,18 +181,33 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto order_by(Args... args)
+					constexpr auto order_by(Args... args) const &
 					-> _new_statement_t<order_by_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), order_by_data_t<void, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), order_by_data_t<void, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto order_by(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<order_by_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), order_by_data_t<void, Args...>{std::move(args)...} };
 					}
 
 				template<typename... Args>
-					auto dynamic_order_by(Args... args)
+					constexpr auto dynamic_order_by(Args... args) const &
 					-> _new_statement_t<order_by_t<_database_t, Args...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_order_by must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), order_by_data_t<_database_t, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), order_by_data_t<_database_t, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto dynamic_order_by(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<order_by_t<_database_t, Args...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_order_by must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), order_by_data_t<_database_t, Args...>{std::move(args)...} };
 					}
 			};
 	};
@@ -27,7 +27,9 @@
 #ifndef SQLPP_PREPARED_SELECT_H
 #define SQLPP_PREPARED_SELECT_H
 
+#include <cstdint>
 #include <sqlpp11/parameter_list.h>
+#include <sqlpp11/dynamic_parameter_list.h>
 #include <sqlpp11/result.h>
 
 namespace sqlpp
@@ -38,22 +40,39 @@ namespace sqlpp
 			using _result_row_t = typename Select::template _result_row_t<Database>;
 			using _parameter_list_t = make_parameter_list_t<Select>;
 			using _dynamic_names_t = typename Select::_dynamic_names_t;
+			using _dynamic_types_t = typename Select::_dynamic_types_t;
 			using _prepared_statement_t = typename Database::_prepared_statement_t;
 
 			auto _run(Database& db) const
 				-> result_t<decltype(db.run_prepared_select(*this)), _result_row_t>
 				{
-					return {db.run_prepared_select(*this), _dynamic_names};
+					return {db.run_prepared_select(*this), _dynamic_names, _dynamic_types};
 				}
 
+			static constexpr uint64_t _get_static_fingerprint()
+			{
+				return Select::_get_static_fingerprint();
+			}
+
+			uint64_t _get_fingerprint() const
+			{
+				return _fingerprint;
+			}
+
 			void _bind_params() const
 			{
-				params._bind(_prepared_statement);
+				if (dynamic_params.empty())
+					params._bind(_prepared_statement);
+				else
+					dynamic_params._bind(params, _prepared_statement);
 			}
 
 			_parameter_list_t params;
+			dynamic_parameter_list_t dynamic_params;
 			_dynamic_names_t _dynamic_names;
+			_dynamic_types_t _dynamic_types;
 			mutable _prepared_statement_t _prepared_statement;
+			uint64_t _fingerprint;
 		};
 
 }
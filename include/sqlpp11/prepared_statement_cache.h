@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_PREPARED_STATEMENT_CACHE_H
+#define SQLPP_PREPARED_STATEMENT_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <sqlpp11/fingerprint.h>
+#include <sqlpp11/literal_values_context.h>
+#include <sqlpp11/detail/type_id.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		struct prepared_statement_key_t
+		{
+			const void* _type;
+			uint64_t _fingerprint;
+			literal_values_t _literals; // the text of the prepared statement contains them
+
+			bool operator==(const prepared_statement_key_t& rhs) const
+			{
+				return _type == rhs._type and _fingerprint == rhs._fingerprint and _literals == rhs._literals;
+			}
+		};
+
+		struct prepared_statement_key_hash_t
+		{
+			std::size_t operator()(const prepared_statement_key_t& key) const
+			{
+				uint64_t hash = fingerprint_combine(key._fingerprint, reinterpret_cast<std::uintptr_t>(key._type));
+				for (const auto& literal : key._literals)
+				{
+					hash = fingerprint_combine(hash, static_cast<uint64_t>(literal._integral));
+					for (const auto c : literal._text)
+						hash = fingerprint_mix(hash, c);
+				}
+				return static_cast<std::size_t>(hash);
+			}
+		};
+
+		// Fingerprints ignore literal values, so they are collected separately (without producing text)
+		template<typename Statement>
+			literal_values_t literal_values_of(const Statement& statement, const std::true_type&)
+			{
+				return sqlpp::literal_values_of(statement);
+			}
+
+		template<typename Statement>
+			literal_values_t literal_values_of(const Statement&, const std::false_type&)
+			{
+				return {};
+			}
+	}
+
+	// A least recently used cache of prepared statements (prepared_select_t, prepared_insert_t, etc).
+	// Entries are keyed by the type of the statement, its fingerprint (i.e. its dynamic shape) and its literal values,
+	// since these are part of the prepared text. Statements should use parameters for everything that varies per call.
+	//
+	// Prepared statements are handed out as shared pointers. An entry that is evicted stays valid for as long as
+	// somebody holds on to it. The release callback is called with the _prepared_statement_t of the entry once the last owner lets go.
+	template<typename Database>
+		class prepared_statement_cache_t
+		{
+		public:
+			using _prepared_statement_t = typename Database::_prepared_statement_t;
+			using release_callback_t = std::function<void(_prepared_statement_t&)>;
+
+		private:
+			using _key_t = detail::prepared_statement_key_t;
+			using _entry_t = std::pair<_key_t, std::shared_ptr<void>>;
+			using _list_t = std::list<_entry_t>;
+
+			std::size_t _capacity;
+			release_callback_t _release;
+			_list_t _entries; // most recently used first
+			std::unordered_map<_key_t, typename _list_t::iterator, detail::prepared_statement_key_hash_t> _index;
+			std::size_t _hits = 0;
+			std::size_t _misses = 0;
+
+			void _shrink_to(std::size_t size)
+			{
+				while (_entries.size() > size)
+				{
+					_index.erase(_entries.back().first);
+					_entries.pop_back();
+				}
+			}
+
+			template<typename Prepared>
+				std::shared_ptr<Prepared> _make_shared(Prepared prepared) const
+				{
+					auto release = _release;
+					return std::shared_ptr<Prepared>(new Prepared(std::move(prepared)), [release](Prepared* p)
+							{
+								if (release)
+									release(p->_prepared_statement);
+								delete p;
+							});
+				}
+
+		public:
+			explicit prepared_statement_cache_t(std::size_t capacity = 64, release_callback_t release = {}):
+				_capacity(capacity),
+				_release(std::move(release))
+			{}
+
+			prepared_statement_cache_t(const prepared_statement_cache_t&) = delete;
+			prepared_statement_cache_t(prepared_statement_cache_t&&) = default;
+			prepared_statement_cache_t& operator=(const prepared_statement_cache_t&) = delete;
+			prepared_statement_cache_t& operator=(prepared_statement_cache_t&&) = default;
+			~prepared_statement_cache_t() = default;
+
+			template<typename Statement>
+				auto prepare(Database& db, const Statement& statement)
+				-> std::shared_ptr<decltype(db.prepare(statement))>
+				{
+					using _prepared_t = decltype(db.prepare(statement));
+
+					const auto key = _key_t{&detail::type_id_t<Statement>::_id, statement._get_fingerprint(),
+						detail::literal_values_of(statement, std::integral_constant<bool, contains_runtime_data_t<Statement>::value>{})};
+					const auto it = _index.find(key);
+					if (it != _index.end())
+					{
+						++_hits;
+						_entries.splice(_entries.begin(), _entries, it->second);
+						return std::static_pointer_cast<_prepared_t>(it->second->second);
+					}
+
+					++_misses;
+					auto prepared = _make_shared(db.prepare(statement));
+					if (_capacity)
+					{
+						_shrink_to(_capacity - 1);
+						_entries.emplace_front(key, prepared);
+						_index.emplace(key, _entries.begin());
+					}
+					return prepared;
+				}
+
+			std::size_t size() const
+			{
+				return _entries.size();
+			}
+
+			std::size_t capacity() const
+			{
+				return _capacity;
+			}
+
+			void set_capacity(std::size_t capacity)
+			{
+				_capacity = capacity;
+				_shrink_to(capacity);
+			}
+
+			std::size_t hits() const
+			{
+				return _hits;
+			}
+
+			std::size_t misses() const
+			{
+				return _misses;
+			}
+
+			void clear()
+			{
+				_shrink_to(0);
+			}
+		};
+
+	// Opt-in mixin for connectors, e.g. class connection: public sqlpp::connection, public sqlpp::cached_prepare_t<connection>
+	// The cache is held by pointer, since Database is still incomplete when the mixin is instantiated as its base.
+	template<typename Database>
+		class cached_prepare_t
+		{
+			std::unique_ptr<prepared_statement_cache_t<Database>> _prepared_statement_cache;
+
+		public:
+			cached_prepare_t():
+				_prepared_statement_cache(new prepared_statement_cache_t<Database>())
+			{}
+
+			explicit cached_prepare_t(prepared_statement_cache_t<Database> cache):
+				_prepared_statement_cache(new prepared_statement_cache_t<Database>(std::move(cache)))
+			{}
+
+			template<typename Statement, typename Db = Database>
+				auto prepare_cached(const Statement& statement)
+				-> decltype(std::declval<prepared_statement_cache_t<Db>&>().prepare(std::declval<Db&>(), statement))
+				{
+					return _prepared_statement_cache->prepare(static_cast<Database&>(*this), statement);
+				}
+
+			prepared_statement_cache_t<Database>& _get_prepared_statement_cache()
+			{
+				return *_prepared_statement_cache;
+			}
+
+			const prepared_statement_cache_t<Database>& _get_prepared_statement_cache() const
+			{
+				return *_prepared_statement_cache;
+			}
+		};
+}
+
+#endif
@@ -27,7 +27,9 @@
 #ifndef SQLPP_PREPARED_UPDATE_H
 #define SQLPP_PREPARED_UPDATE_H
 
+#include <cstdint>
 #include <sqlpp11/parameter_list.h>
+#include <sqlpp11/dynamic_parameter_list.h>
 #include <sqlpp11/result.h>
 
 namespace sqlpp
@@ -44,13 +46,28 @@ namespace sqlpp
 					return db.run_prepared_insert(*this);
 				}
 
+			static constexpr uint64_t _get_static_fingerprint()
+			{
+				return Update::_get_static_fingerprint();
+			}
+
+			uint64_t _get_fingerprint() const
+			{
+				return _fingerprint;
+			}
+
 			void _bind_params() const
 			{
-				params._bind(_prepared_statement);
+				if (dynamic_params.empty())
+					params._bind(_prepared_statement);
+				else
+					dynamic_params._bind(params, _prepared_statement);
 			}
 
 			_parameter_list_t params;
+			dynamic_parameter_list_t dynamic_params;
 			mutable _prepared_statement_t _prepared_statement;
+			uint64_t _fingerprint;
 		};
 
 }
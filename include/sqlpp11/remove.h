@@ -70,7 +70,7 @@ namespace sqlpp
 					 {
 						 _statement_t::_check_consistency();
 
-						 return {{}, db.prepare_remove(_get_statement())};
+						 return {{}, _get_statement()._get_dynamic_parameters(), db.prepare_remove(_get_statement()), _get_statement()._get_fingerprint()};
 					 }
 			};
 	};
@@ -98,32 +98,46 @@ namespace sqlpp
 					no_where_t<true>
 						>;
 
-	auto remove()
+	constexpr auto remove()
 		-> blank_remove_t<void>
 		{
 			return { blank_remove_t<void>() };
 		}
 
 	template<typename Table>
-		auto remove_from(Table table)
+		constexpr auto remove_from(Table table)
 		-> decltype(blank_remove_t<void>().from(table))
 		{
 			return { blank_remove_t<void>().from(table) };
 		}
 
 	template<typename Database>
-		auto  dynamic_remove(const Database&)
+		constexpr auto  dynamic_remove(const Database&)
 		-> decltype(blank_remove_t<Database>())
 		{
 			return { blank_remove_t<Database>() };
 		}
 
 	template<typename Database, typename Table>
-		auto  dynamic_remove_from(const Database&, Table table)
+		constexpr auto  dynamic_remove_from(const Database&, Table table)
 		-> decltype(blank_remove_t<Database>().from(table))
 		{
 			return { blank_remove_t<Database>().from(table) };
 		}
+
+	template<typename Database>
+		auto dynamic_remove(const Database&, monotonic_arena_t& arena)
+		-> blank_remove_t<Database>
+		{
+			return { blank_remove_t<Database>(arena) };
+		}
+
+	template<typename Database, typename Table>
+		auto dynamic_remove_from(const Database&, monotonic_arena_t& arena, Table table)
+		-> decltype(blank_remove_t<Database>(arena).from(table))
+		{
+			return { blank_remove_t<Database>(arena).from(table) };
+		}
 }
 
 #endif
@@ -27,7 +27,10 @@
 #ifndef SQLPP_RESULT_H
 #define SQLPP_RESULT_H
 
-// FIXME: include for move?
+#include <type_traits>
+#include <utility>
+#include <sqlpp11/type_traits.h>
+
 namespace sqlpp
 {
 	template<typename DbResult, typename ResultRow>
@@ -44,18 +47,38 @@ namespace sqlpp
 		public:
 			result_t() = default;
 
-			template<typename DynamicNames>
-				result_t(db_result_t&& result, const DynamicNames& dynamic_names):
+			template<typename... DynamicColumns>
+				result_t(db_result_t&& result, const DynamicColumns&... dynamic_columns):
 					_result(std::move(result)),
-					_result_row(dynamic_names)
+					_result_row(dynamic_columns...)
 			{
+				_bind_once(connector_binds_result_once_t<db_result_t>{});
 				_result.next(_result_row);
 			}
 
 			result_t(const result_t&) = delete;
-			result_t(result_t&&) = default;
+
+			// Results that bind once have to bind the moved row again
+			result_t(result_t&& rhs):
+				_result(std::move(rhs._result)),
+				_result_row(std::move(rhs._result_row)),
+				_end(std::move(rhs._end)),
+				_end_row(std::move(rhs._end_row))
+			{
+				_rebind_once();
+			}
+
 			result_t& operator=(const result_t&) = delete;
-			result_t& operator=(result_t&&) = default;
+
+			result_t& operator=(result_t&& rhs)
+			{
+				_result = std::move(rhs._result);
+				_result_row = std::move(rhs._result_row);
+				_end = std::move(rhs._end);
+				_end_row = std::move(rhs._end_row);
+				_rebind_once();
+				return *this;
+			}
 
 			// Iterator
 			class iterator
@@ -121,6 +144,25 @@ namespace sqlpp
 				_result.next(_result_row);
 			}
 
+		private:
+			// With result protocol 2, the connector learns the addresses of the row's fields once.
+			// Later calls of next() only fill in the values.
+			void _bind_once(const std::true_type&)
+			{
+				_result_row._bind(_result);
+			}
+
+			void _bind_once(const std::false_type&)
+			{
+			}
+
+			// Default constructed, moved-from and exhausted results have no row to bind
+			void _rebind_once()
+			{
+				if (_result_row)
+					_bind_once(connector_binds_result_once_t<db_result_t>{});
+			}
+
 		};
 }
 
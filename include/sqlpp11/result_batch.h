@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_RESULT_BATCH_H
+#define SQLPP_RESULT_BATCH_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <sqlpp11/field.h>
+#include <sqlpp11/type_traits.h>
+#include <sqlpp11/detail/column_index_sequence.h>
+#include <sqlpp11/detail/logic.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		template<typename NamedExpr>
+			struct is_multi_field_impl: std::false_type {};
+
+		template<typename AliasProvider, typename FieldTuple>
+			struct is_multi_field_impl<multi_field_t<AliasProvider, FieldTuple>>: std::true_type {};
+
+		template<typename Db, typename IndexSequence, typename... NamedExprs>
+			struct result_batch_impl;
+
+		template<typename Db, std::size_t index, typename NamedExpr>
+			struct result_column:
+				public NamedExpr::_name_t::template _member_t<typename value_type_of<NamedExpr>::template _result_column_t<Db>>
+		{
+			using _column = typename NamedExpr::_name_t::template _member_t<typename value_type_of<NamedExpr>::template _result_column_t<Db>>;
+
+			result_column() = default;
+
+			void _resize(std::size_t capacity)
+			{
+				_column::operator()()._resize(capacity);
+			}
+
+			template<typename Target>
+				void _bind(Target& target)
+				{
+					_column::operator()()._bind(target, index);
+				}
+		};
+
+		template<typename Db, std::size_t LastIndex, std::size_t... Is, typename... NamedExprs>
+			struct result_batch_impl<Db, detail::column_index_sequence<LastIndex, Is...>, NamedExprs...>: 
+			public result_column<Db, Is, NamedExprs>...
+			{
+				result_batch_impl() = default;
+
+				void _resize(std::size_t capacity)
+				{
+					using swallow = int[];
+					(void) swallow{(result_column<Db, Is, NamedExprs>::_resize(capacity), 0)...};
+				}
+
+				template<typename Target>
+					void _bind(Target& target)
+					{
+						using swallow = int[];
+						(void) swallow{(result_column<Db, Is, NamedExprs>::_bind(target), 0)...};
+					}
+			};
+	}
+
+	// Up to capacity() rows of a select result, stored column by column, e.g.
+	//
+	//   for (const auto& batch : fetch_batches(db, select(t.alpha, t.beta).from(t).where(true), 1024))
+	//     for (std::size_t i = 0; i < batch.size(); ++i)
+	//       sum += batch.alpha[i];
+	//
+	// The contents are valid until the next batch is fetched.
+	template<typename Db, typename... NamedExprs>
+		struct result_batch_t: public detail::result_batch_impl<Db, detail::make_column_index_sequence<0, NamedExprs...>, NamedExprs...>
+	{
+		static_assert(detail::none_t<detail::is_multi_field_impl<NamedExprs>::value...>::value, "multi columns are not supported in result batches");
+		using _impl = detail::result_batch_impl<Db, detail::make_column_index_sequence<0, NamedExprs...>, NamedExprs...>;
+
+		explicit result_batch_t(std::size_t capacity):
+			_impl(),
+			_capacity(capacity),
+			_size(0)
+		{
+			_impl::_resize(capacity);
+		}
+
+		result_batch_t(const result_batch_t&) = delete;
+		result_batch_t(result_batch_t&&) = default;
+		result_batch_t& operator=(const result_batch_t&) = delete;
+		result_batch_t& operator=(result_batch_t&&) = default;
+
+		std::size_t capacity() const
+		{
+			return _capacity;
+		}
+
+		std::size_t size() const
+		{
+			return _size;
+		}
+
+		bool empty() const
+		{
+			return _size == 0;
+		}
+
+		// Called by the connector after filling the columns
+		void _set_size(std::size_t size)
+		{
+			_size = size;
+		}
+
+		template<typename Target>
+			void _bind(Target& target)
+			{
+				_impl::_bind(target);
+			}
+
+	private:
+		std::size_t _capacity;
+		std::size_t _size;
+	};
+
+	// A range of result batches, the columnar counterpart of result_t.
+	// The connector's result fills one batch per call of next_batch(), see connector_api/bind_result.h
+	template<typename DbResult, typename ResultBatch>
+		class batch_result_t
+		{
+			using db_result_t = DbResult;
+			using result_batch_t = ResultBatch;
+
+			db_result_t _result;
+			result_batch_t _batch;
+
+		public:
+			batch_result_t(db_result_t&& result, std::size_t batch_size):
+				_result(std::move(result)),
+				_batch(batch_size)
+			{
+				_result.next_batch(_batch);
+			}
+
+			batch_result_t(const batch_result_t&) = delete;
+			batch_result_t(batch_result_t&&) = default;
+			batch_result_t& operator=(const batch_result_t&) = delete;
+			batch_result_t& operator=(batch_result_t&&) = default;
+
+			// Iterator
+			class iterator
+			{
+			public:
+				iterator(batch_result_t* result):
+					_result(result)
+				{
+				}
+
+				const result_batch_t& operator*() const
+				{
+					return _result->_batch;
+				}
+
+				const result_batch_t* operator->() const
+				{
+					return &_result->_batch;
+				}
+
+				// All iterators are equal to end() once there are no more rows
+				bool operator==(const iterator& rhs) const
+				{
+					return (_result and not _result->empty() ? _result : nullptr) == (rhs._result and not rhs._result->empty() ? rhs._result : nullptr);
+				}
+
+				bool operator!=(const iterator& rhs) const
+				{
+					return not (operator==(rhs));
+				}
+
+				void operator++()
+				{
+					_result->pop_front();
+				}
+
+				batch_result_t* _result;
+			};
+
+			iterator begin()
+			{
+				return iterator(this);
+			}
+
+			iterator end()
+			{
+				return iterator(nullptr);
+			}
+
+			const result_batch_t& front() const
+			{
+				return _batch;
+			}
+
+			bool empty() const
+			{
+				return _batch.empty();
+			}
+
+			void pop_front()
+			{
+				_result.next_batch(_batch);
+			}
+		};
+
+	template<typename Db, typename Select>
+		auto fetch_batches(Db& db, const Select& s, std::size_t batch_size)
+		-> decltype(s._run_batches(db, batch_size))
+		{
+			return s._run_batches(db, batch_size);
+		}
+}
+
+#endif
@@ -27,9 +27,11 @@
 #ifndef SQLPP_RESULT_ROW_H
 #define SQLPP_RESULT_ROW_H
 
-#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <sqlpp11/field.h>
-#include <sqlpp11/text.h>
+#include <sqlpp11/dynamic_field.h>
 #include <sqlpp11/detail/column_index_sequence.h>
 
 namespace sqlpp
@@ -132,8 +134,8 @@ namespace sqlpp
 		{
 		}
 
-		template<typename DynamicNames>
-			result_row_t(const DynamicNames&):
+		template<typename... DynamicColumns>
+			result_row_t(const DynamicColumns&...):
 				_impl(),
 				_is_valid(false)
 		{
@@ -178,16 +180,23 @@ namespace sqlpp
 			}
 	};
 
+	// Identifies a dynamic field by its position, see dynamic_result_row_t::get_handle()
+	struct dynamic_field_handle_t
+	{
+		std::size_t _index;
+	};
+
 	template<typename Db, typename... NamedExprs>
 		struct dynamic_result_row_t: public detail::result_row_impl<Db, detail::make_column_index_sequence<0, NamedExprs...>, NamedExprs...>
 	{
 		using _impl = detail::result_row_impl<Db, detail::make_column_index_sequence<0, NamedExprs...>, NamedExprs...>;
-		using _field_type = detail::text::_result_entry_t<Db, false>;
+		using _field_type = dynamic_field_t<Db>;
 		static constexpr size_t _last_static_index = _impl::_last_index;
 
 		bool _is_valid;
-		std::vector<std::string> _dynamic_columns;
-		std::map<std::string, _field_type> _dynamic_fields;
+		// Dynamic fields are stored in the order of the dynamic columns, names are resolved via the index
+		std::vector<_field_type> _dynamic_fields;
+		std::unordered_map<std::string, std::size_t> _dynamic_index;
 
 		dynamic_result_row_t(): 
 			_impl(),
@@ -195,14 +204,21 @@ namespace sqlpp
 		{
 		}
 
+		// Without value types, all dynamic fields are fetched as text
 		dynamic_result_row_t(const std::vector<std::string>& dynamic_columns): 
+			dynamic_result_row_t(dynamic_columns, std::vector<dynamic_field_type_t>(dynamic_columns.size(), dynamic_field_type_t::text))
+		{
+		}
+
+		dynamic_result_row_t(const std::vector<std::string>& dynamic_columns, const std::vector<dynamic_field_type_t>& dynamic_types): 
 			_impl(),
 			_is_valid(false),
-			_dynamic_columns(dynamic_columns)
+			_dynamic_fields(dynamic_types.begin(), dynamic_types.end())
 		{
-			for (auto name : _dynamic_columns)
+			_dynamic_index.reserve(dynamic_columns.size());
+			for (std::size_t i = 0; i < dynamic_columns.size(); ++i)
 			{
-				_dynamic_fields.insert({name, _field_type{}});
+				_dynamic_index.emplace(dynamic_columns[i], i);
 			}
 		}
 
@@ -218,7 +234,7 @@ namespace sqlpp
 			_is_valid = true;
 			for (auto& field : _dynamic_fields)
 			{
-				field.second._validate();
+				field._validate();
 			}
 		}
 
@@ -228,7 +244,7 @@ namespace sqlpp
 			_is_valid = false;
 			for (auto& field : _dynamic_fields)
 			{
-				field.second._invalidate();
+				field._invalidate();
 			}
 		}
 
@@ -237,9 +253,30 @@ namespace sqlpp
 			return _is_valid == rhs._is_valid;
 		}
 
+		// Resolve the name once, e.g. before iterating over the result, and use the handle for each row
+		dynamic_field_handle_t get_handle(const std::string& field_name) const
+		{
+			return {_dynamic_index.at(field_name)};
+		}
+
 		const _field_type& at(const std::string& field_name) const
 		{
-			return _dynamic_fields.at(field_name);
+			return _dynamic_fields[_dynamic_index.at(field_name)];
+		}
+
+		const _field_type& at(dynamic_field_handle_t handle) const
+		{
+			return _dynamic_fields.at(handle._index);
+		}
+
+		const _field_type& operator[](dynamic_field_handle_t handle) const
+		{
+			return _dynamic_fields[handle._index];
+		}
+
+		std::size_t dynamic_size() const
+		{
+			return _dynamic_fields.size();
 		}
 
 		explicit operator bool() const
@@ -253,9 +290,9 @@ namespace sqlpp
 				_impl::_bind(target);
 
 				std::size_t index = _last_static_index;
-				for (const auto& name  : _dynamic_columns)
+				for (auto& field : _dynamic_fields)
 				{
-					_dynamic_fields.at(name)._bind(target, ++index);
+					field._bind(target, ++index);
 				}
 			}
 	};
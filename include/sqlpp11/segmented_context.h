@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_SEGMENTED_CONTEXT_H
+#define SQLPP_SEGMENTED_CONTEXT_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sqlpp11/serializer_context.h>
+
+namespace sqlpp
+{
+	// A piece of serialized text, layout-compatible in spirit with struct iovec
+	struct segment_t
+	{
+		const char* data;
+		std::size_t size;
+	};
+
+	// A serializer context that does not copy large text values into its buffer.
+	// Instead, it refers to them and yields the statement as a chain of segments,
+	// which connectors can hand to writev() or their wire protocol.
+	// The serialized statement therefore has to outlive the use of segments().
+	struct segmented_context_t: public serializer_context_t
+	{
+		// Clean (quote free) spans of text values of at least this length are referenced instead of copied
+		std::size_t _borrow_threshold = 4096;
+
+		void append_escaped(const char* s, std::size_t len)
+		{
+			// Skeletons record literal positions in the buffer, so everything has to be copied while they are rendered
+			if (len < _borrow_threshold or _literal_offsets)
+			{
+				serializer_context_t::append_escaped(s, len);
+				return;
+			}
+
+			const char* const end = s + len;
+			while (s != end)
+			{
+				const char* quote = static_cast<const char*>(std::memchr(s, '\'', static_cast<std::size_t>(end - s)));
+				const char* span_end = quote ? quote : end;
+				const std::size_t span_length = static_cast<std::size_t>(span_end - s);
+				if (span_length >= _borrow_threshold)
+					_borrowed.push_back({size(), s, span_length});
+				else
+					append(s, span_length);
+				if (not quote)
+					break;
+				append("''", 2);
+				s = quote + 1;
+			}
+		}
+
+		void append_escaped(const std::string& s)
+		{
+			append_escaped(s.data(), s.size());
+		}
+
+		// The owned fragments and borrowed values in order
+		std::vector<segment_t> segments() const
+		{
+			std::vector<segment_t> result;
+			result.reserve(2 * _borrowed.size() + 1);
+			std::size_t position = 0;
+			for (const auto& borrowed : _borrowed)
+			{
+				if (borrowed._position > position)
+					result.push_back({data() + position, borrowed._position - position});
+				result.push_back({borrowed._data, borrowed._size});
+				position = borrowed._position;
+			}
+			if (size() > position)
+				result.push_back({data() + position, size() - position});
+			return result;
+		}
+
+		std::size_t total_size() const
+		{
+			std::size_t total = size();
+			for (const auto& borrowed : _borrowed)
+				total += borrowed._size;
+			return total;
+		}
+
+		bool empty() const
+		{
+			return serializer_context_t::empty() and _borrowed.empty();
+		}
+
+		// Concatenates all segments
+		std::string str() const
+		{
+			std::string result;
+			result.reserve(total_size());
+			for (const auto& segment : segments())
+				result.append(segment.data, segment.size);
+			return result;
+		}
+
+		// Also drops the values referenced after the first size characters
+		void truncate(std::size_t size)
+		{
+			serializer_context_t::truncate(size);
+			while (not _borrowed.empty() and _borrowed.back()._position > size)
+				_borrowed.pop_back();
+		}
+
+		void reset()
+		{
+			serializer_context_t::reset();
+			_borrowed.clear();
+		}
+
+	private:
+		struct _borrowed_t
+		{
+			std::size_t _position; // in the owned buffer
+			const char* _data;
+			std::size_t _size;
+		};
+
+		std::vector<_borrowed_t> _borrowed;
+	};
+}
+
+#endif
@@ -79,30 +79,43 @@ namespace sqlpp
 					no_offset_t>;
 
 
-	blank_select_t<void> select() // FIXME: These should be constexpr
+	constexpr blank_select_t<void> select()
 	{
 		return { };
 	}
 
 	template<typename... Columns>
-		auto select(Columns... columns)
+		constexpr auto select(Columns... columns)
 		-> decltype(blank_select_t<void>().columns(columns...))
 		{
 			return blank_select_t<void>().columns(columns...);
 		}
 
 	template<typename Database>
-		blank_select_t<Database> dynamic_select(const Database&)
+		constexpr blank_select_t<Database> dynamic_select(const Database&)
 		{
 			return { };
 		}
 
 	template<typename Database, typename... Columns>
-		auto dynamic_select(const Database&, Columns... columns)
+		constexpr auto dynamic_select(const Database&, Columns... columns)
 		-> decltype(blank_select_t<Database>().columns(columns...))
 		{
 			return blank_select_t<Database>().columns(columns...);
 		}
 
+	template<typename Database>
+		blank_select_t<Database> dynamic_select(const Database&, monotonic_arena_t& arena)
+		{
+			return blank_select_t<Database>(arena);
+		}
+
+	template<typename Database, typename... Columns>
+		auto dynamic_select(const Database&, monotonic_arena_t& arena, Columns... columns)
+		-> decltype(blank_select_t<Database>(arena).columns(columns...))
+		{
+			return blank_select_t<Database>(arena).columns(columns...);
+		}
+
 }
 #endif
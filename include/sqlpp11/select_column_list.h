@@ -28,13 +28,16 @@
 #define SQLPP_SELECT_COLUMN_LIST_H
 
 #include <tuple>
+#include <utility>
 #include <sqlpp11/result_row.h>
+#include <sqlpp11/result_batch.h>
 #include <sqlpp11/table.h>
 #include <sqlpp11/no_value.h>
 #include <sqlpp11/field.h>
 #include <sqlpp11/expression_fwd.h>
 #include <sqlpp11/select_pseudo_table.h>
 #include <sqlpp11/named_interpretable.h>
+#include <sqlpp11/monotonic_arena.h>
 #include <sqlpp11/interpret_tuple.h>
 #include <sqlpp11/policy_update.h>
 #include <sqlpp11/detail/type_set.h>
@@ -63,13 +66,16 @@ namespace sqlpp
 		struct dynamic_select_column_list
 		{
 			using _names_t = std::vector<std::string>;
-			std::vector<named_interpretable_t<Db>> _dynamic_columns;
+			using _types_t = std::vector<dynamic_field_type_t>;
+			detail::arena_vector_t<named_interpretable_t<Db>> _dynamic_columns;
 			_names_t _dynamic_expression_names;
+			_types_t _dynamic_expression_types;
 
 			template<typename Expr>
 				void emplace_back(Expr expr)
 				{
 					_dynamic_expression_names.push_back(Expr::_name_t::_get_name());
+					_dynamic_expression_types.push_back(detail::dynamic_field_type_of<Expr>());
 					_dynamic_columns.emplace_back(expr);
 				}
 
@@ -77,6 +83,11 @@ namespace sqlpp
 			{
 				return _dynamic_columns.empty();
 			}
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				detail::bind_arena(_dynamic_columns, arena);
+			}
 		};
 
 	template<>
@@ -86,12 +97,17 @@ namespace sqlpp
 			{
 				static constexpr size_t size() { return 0; }
 			};
+			using _types_t = _names_t;
 			_names_t _dynamic_expression_names;
+			_types_t _dynamic_expression_types;
 
 			static constexpr bool empty()
 			{
 				return true;
 			}
+
+			void _bind_arena(monotonic_arena_t*)
+			{}
 		};
 
 	template<typename Context, typename Db>
@@ -102,7 +118,7 @@ namespace sqlpp
 			static Context& _(const T& t, Context& context)
 			{
 				bool first = true;
-				for (const auto column : t._dynamic_columns)
+				for (const auto& column : t._dynamic_columns)
 				{
 					if (first)
 						first = false;
@@ -129,11 +145,11 @@ namespace sqlpp
 	template<typename Database, typename... Columns>
 		struct select_column_list_data_t
 		{
-			select_column_list_data_t(Columns... columns):
-				_columns(columns...)
+			constexpr select_column_list_data_t(Columns... columns):
+				_columns(std::move(columns)...)
 			{}
 
-			select_column_list_data_t(std::tuple<Columns...> columns):
+			constexpr select_column_list_data_t(std::tuple<Columns...> columns):
 				_columns(columns)
 			{}
 
@@ -145,6 +161,11 @@ namespace sqlpp
 
 			std::tuple<Columns...> _columns;
 			dynamic_select_column_list<Database> _dynamic_columns;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_columns._bind_arena(arena);
+			}
 		};
 
 
@@ -221,7 +242,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return selected_columns; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.selected_columns)
+						static constexpr auto _get_member(T& t) -> decltype((t.selected_columns))
 						{
 							return t.selected_columns;
 						}
@@ -250,7 +271,11 @@ namespace sqlpp
 									dynamic_result_row_t<Db, make_field_t<Columns>...>,
 									result_row_t<Db, make_field_t<Columns>...>>::type;
 
+					template<typename Db>
+						using _result_batch_t = result_batch_t<Db, make_field_t<Columns>...>;
+
 					using _dynamic_names_t = typename dynamic_select_column_list<Database>::_names_t;
+					using _dynamic_types_t = typename dynamic_select_column_list<Database>::_types_t;
 
 					template<typename AliasProvider>
 						struct _deferred_table_t
@@ -278,6 +303,11 @@ namespace sqlpp
 						return _get_statement().selected_columns._data._dynamic_columns._dynamic_expression_names;
 					}
 
+					const _dynamic_types_t& _get_dynamic_types() const
+					{
+						return _get_statement().selected_columns._data._dynamic_columns._dynamic_expression_types;
+					}
+
 					size_t get_no_of_result_columns() const
 					{
 						return sizeof...(Columns) + get_dynamic_names().size();
@@ -291,7 +321,19 @@ namespace sqlpp
 							_statement_t::_check_consistency();
 							static_assert(_statement_t::_get_static_no_of_parameters() == 0, "cannot run select directly with parameters, use prepare instead");
 
-							return {db.select(_get_statement()), get_dynamic_names()};
+							return {db.select(_get_statement()), get_dynamic_names(), _get_dynamic_types()};
+						}
+
+					// Execute, fetching batch_size rows at a time into columns, see fetch_batches()
+					template<typename Db>
+						auto _run_batches(Db& db, size_t batch_size) const
+						-> batch_result_t<decltype(db.select(this->_get_statement())), _result_batch_t<Db>>
+						{
+							_statement_t::_check_consistency();
+							static_assert(_statement_t::_get_static_no_of_parameters() == 0, "cannot run select directly with parameters, use prepare instead");
+							static_assert(not _is_dynamic::value, "dynamic columns are not supported in result batches");
+
+							return {db.select(_get_statement()), batch_size};
 						}
 
 					// Prepare
@@ -301,7 +343,7 @@ namespace sqlpp
 						{
 							_statement_t::_check_consistency();
 
-							return {{}, get_dynamic_names(), db.prepare_select(_get_statement())};
+							return {{}, _get_statement()._get_dynamic_parameters(), get_dynamic_names(), _get_dynamic_types(), db.prepare_select(_get_statement()), _get_statement()._get_fingerprint()};
 						}
 				};
 
@@ -343,7 +385,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_selected_columns; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_selected_columns)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_selected_columns))
 					{
 						return t.no_selected_columns;
 					}
@@ -360,18 +402,33 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto columns(Args... args)
+					constexpr auto columns(Args... args) const &
 					-> _new_statement_t<::sqlpp::detail::make_select_column_list_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), typename ::sqlpp::detail::make_select_column_list_t<void, Args...>::_data_t{std::tuple_cat(::sqlpp::detail::as_tuple<Args>::_(args)...)} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), typename ::sqlpp::detail::make_select_column_list_t<void, Args...>::_data_t{std::tuple_cat(::sqlpp::detail::as_tuple<Args>::_(args)...)} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto columns(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<::sqlpp::detail::make_select_column_list_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), typename ::sqlpp::detail::make_select_column_list_t<void, Args...>::_data_t{std::tuple_cat(::sqlpp::detail::as_tuple<Args>::_(args)...)} };
 					}
 
 				template<typename... Args>
-					auto dynamic_columns(Args... args)
+					constexpr auto dynamic_columns(Args... args) const &
 					-> _new_statement_t<::sqlpp::detail::make_select_column_list_t<_database_t, Args...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_columns must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), typename ::sqlpp::detail::make_select_column_list_t<_database_t, Args...>::_data_t{std::tuple_cat(::sqlpp::detail::as_tuple<Args>::_(args)...)} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), typename ::sqlpp::detail::make_select_column_list_t<_database_t, Args...>::_data_t{std::tuple_cat(::sqlpp::detail::as_tuple<Args>::_(args)...)} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto dynamic_columns(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<::sqlpp::detail::make_select_column_list_t<_database_t, Args...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_columns must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), typename ::sqlpp::detail::make_select_column_list_t<_database_t, Args...>::_data_t{std::tuple_cat(::sqlpp::detail::as_tuple<Args>::_(args)...)} };
 					}
 			};
 	};
@@ -28,6 +28,7 @@
 #define SQLPP_SELECT_FLAG_LIST_H
 
 #include <tuple>
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/no_data.h>
 #include <sqlpp11/select_flags.h>
@@ -41,8 +42,8 @@ namespace sqlpp
 	template<typename Database, typename... Flags>
 		struct select_flag_list_data_t
 		{
-			select_flag_list_data_t(Flags... flags):
-				_flags(flags...)
+			constexpr select_flag_list_data_t(Flags... flags):
+				_flags(std::move(flags)...)
 			{}
 
 			select_flag_list_data_t(const select_flag_list_data_t&) = default;
@@ -53,6 +54,11 @@ namespace sqlpp
 
 			std::tuple<Flags...> _flags;
 			interpretable_list_t<Database> _dynamic_flags;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_flags._bind_arena(arena);
+			}
 		};
 
 	// SELECT FLAGS
@@ -117,7 +123,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return select_flags; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.select_flags)
+						static constexpr auto _get_member(T& t) -> decltype((t.select_flags))
 						{
 							return t.select_flags;
 						}
@@ -158,7 +164,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_select_flags; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_select_flags)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_select_flags))
 					{
 						return t.no_select_flags;
 					}
@@ -174,18 +180,33 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto flags(Args... args)
+					constexpr auto flags(Args... args) const &
 					-> _new_statement_t<select_flag_list_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), select_flag_list_data_t<void, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), select_flag_list_data_t<void, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto flags(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<select_flag_list_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), select_flag_list_data_t<void, Args...>{std::move(args)...} };
 					}
 
 				template<typename... Args>
-					auto dynamic_flags(Args... args)
+					constexpr auto dynamic_flags(Args... args) const &
 					-> _new_statement_t<select_flag_list_t<_database_t, Args...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_flags must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), select_flag_list_data_t<_database_t, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), select_flag_list_data_t<_database_t, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto dynamic_flags(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<select_flag_list_t<_database_t, Args...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_flags must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), select_flag_list_data_t<_database_t, Args...>{std::move(args)...} };
 					}
 			};
 	};
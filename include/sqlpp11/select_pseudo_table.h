@@ -56,7 +56,14 @@ namespace sqlpp
 																						 NamedExpr...>, select_column_spec_t<value_type_of<NamedExpr>, typename NamedExpr::_name_t>...>
 	{
 		using _traits = make_traits<no_value_t, tag::table, tag::pseudo_table>;
-		using _recursive_traits = make_recursive_traits<>;
+		struct _recursive_traits
+		{
+			using _parameters = std::tuple<>;
+			using _required_tables = detail::type_set<>;
+			using _provided_tables = detail::type_set<>;
+			using _extra_tables = detail::type_set<>;
+			using _tags = recursive_tags_of<Select>;
+		};
 
 		select_pseudo_table_t(Select select):
 			_select(select)
@@ -23,45 +23,341 @@
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+
 #ifndef SQLPP_SERIALIZER_CONTEXT_H
 #define SQLPP_SERIALIZER_CONTEXT_H
 
+#include <cstring>
 #include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <sqlpp11/detail/string_buffer.h>
+#include <sqlpp11/detail/number_format.h>
+#include <sqlpp11/literal_value.h>
 
 namespace sqlpp
 {
+	// The default serializer context appends the statement text to a contiguous buffer.
+	// Connectors may derive from it or provide their own context with the same interface.
 	struct serializer_context_t
 	{
+		serializer_context_t() = default;
+		serializer_context_t(const serializer_context_t&) = default;
+		serializer_context_t(serializer_context_t&&) = default;
+		serializer_context_t& operator=(const serializer_context_t&) = default;
+		serializer_context_t& operator=(serializer_context_t&&) = default;
+
+		// Deprecated: Kept for connectors that serialize into a stream, use str() or data() and size() instead.
+		// The text is written to the stream by flush(), str() and the destructor.
 		serializer_context_t(std::ostream& os):
-			_os(os)
+			_os(&os)
 		{}
 
+		~serializer_context_t()
+		{
+			flush();
+		}
+
+		// Writes the text that has not been written yet to the stream given to the constructor, if any
+		void flush() const
+		{
+			if (_os and _buffer.size() > _flushed)
+			{
+				_os->write(_buffer.data() + _flushed, static_cast<std::streamsize>(_buffer.size() - _flushed));
+				_flushed = _buffer.size();
+			}
+		}
+
 		template<typename T>
-			std::ostream& operator<<(T t)
+			serializer_context_t& operator<<(const T& t)
 			{
-				return _os << t;
+				append(t);
+				return *this;
 			}
 
-		static std::string escape(std::string arg)
+		// Taking the pointer by value avoids odr-using static constexpr names like op::plus::_name
+		serializer_context_t& operator<<(const char* s)
+		{
+			append(s);
+			return *this;
+		}
+
+		void append(char c)
+		{
+			_buffer.append(c);
+		}
+
+		void append(const char* s)
+		{
+			_buffer.append(s, std::strlen(s));
+		}
+
+		void append(const char* s, std::size_t len)
+		{
+			_buffer.append(s, len);
+		}
+
+		void append(const std::string& s)
 		{
-			if (arg.find('\''))
+			_buffer.append(s.data(), s.size());
+		}
+
+		void append(bool b)
+		{
+			_buffer.append(b ? '1' : '0');
+		}
+
+		template<typename T>
+			auto append(T t)
+			-> typename std::enable_if<std::is_integral<T>::value, void>::type
 			{
-				std::string retVal;
-				for (const auto c : arg)
-				{
-					if (c == '\'')
-						retVal.push_back(c);
-					retVal.push_back(c);
-				}
-				return retVal;
+				char buffer[detail::number_buffer_size];
+				append(detail::integral_to_chars(t, buffer));
+			}
+
+		template<typename T>
+			auto append(T t)
+			-> typename std::enable_if<std::is_floating_point<T>::value, void>::type
+			{
+				char buffer[detail::number_buffer_size];
+				append(detail::floating_point_to_chars(static_cast<double>(t), buffer));
+			}
+
+		// Appends the text with single quotes doubled.
+		// Clean spans between quotes are found with memchr (which is vectorized by common C libraries)
+		// and copied in bulk, so no temporary string is created.
+		void append_escaped(const char* s, std::size_t len)
+		{
+			const char* const end = s + len;
+			while (const char* quote = static_cast<const char*>(std::memchr(s, '\'', static_cast<std::size_t>(end - s))))
+			{
+				_buffer.append(s, static_cast<std::size_t>(quote - s) + 1);
+				_buffer.append('\'');
+				s = quote + 1;
 			}
-			else
+			_buffer.append(s, static_cast<std::size_t>(end - s));
+		}
+
+		void append_escaped(const std::string& s)
+		{
+			append_escaped(s.data(), s.size());
+		}
+
+		std::string str() const
+		{
+			flush();
+			return _buffer.str();
+		}
+
+		void reset()
+		{
+			_buffer.clear();
+			_flushed = 0;
+		}
+
+		void reserve(std::size_t capacity)
+		{
+			_buffer.reserve(capacity);
+		}
+
+		// Drops everything after the first size characters, e.g. after a failed attempt to serialize
+		void truncate(std::size_t size)
+		{
+			if (size < _buffer.size())
+				_buffer.shrink(_buffer.size() - size);
+			if (size < _flushed)
+				_flushed = size;
+		}
+
+		std::size_t size() const
+		{
+			return _buffer.size();
+		}
+
+		std::size_t capacity() const
+		{
+			return _buffer.capacity();
+		}
+
+		bool empty() const
+		{
+			return _buffer.empty();
+		}
+
+		const char* data() const
+		{
+			return _buffer.data();
+		}
+
+		static std::string escape(const std::string& arg)
+		{
+			if (arg.find('\'') == std::string::npos)
 				return arg;
+
+			std::string retVal;
+			retVal.reserve(arg.size() + 2);
+			for (const auto c : arg)
+			{
+				if (c == '\'')
+					retVal.push_back(c);
+				retVal.push_back(c);
+			}
+			return retVal;
+		}
+
+		// Literal values mark their position in the text while a statement skeleton is rendered, see skeleton.h
+		void _begin_literal()
+		{
+			if (_literal_offsets)
+				_literal_offsets->push_back(_buffer.size());
+		}
+
+		void _end_literal()
+		{
+			if (_literal_offsets)
+				_literal_offsets->push_back(_buffer.size());
 		}
 
-		std::ostream& _os;
+		std::vector<std::size_t>* _literal_offsets = nullptr;
+
+		// In auto parameterize mode, literal values are serialized as placeholders and appended to values.
+		// Connectors can then prepare a single statement per shape and bind the values.
+		// Calling it with nullptr switches the mode off.
+		void auto_parameterize(literal_values_t* values)
+		{
+			_auto_parameters = values;
+		}
+
+		template<typename T>
+			bool _parameterize_literal(const T& value)
+			{
+				if (not _auto_parameters)
+					return false;
+				_auto_parameters->emplace_back(value);
+				_buffer.append('?');
+				return true;
+			}
+
+		literal_values_t* _auto_parameters = nullptr;
+
+	private:
+		detail::string_buffer_t _buffer;
+		std::ostream* _os = nullptr;
+		mutable std::size_t _flushed = 0;
 	};
+
+	namespace detail
+	{
+		// append_escaped() doubles quotes like serializer_context_t::escape() does.
+		// It must not be used by contexts that replace escape(), e.g. with the escape function of their driver.
+		constexpr bool is_default_escape(std::string (*escape)(const std::string&))
+		{
+			return escape == &serializer_context_t::escape;
+		}
+
+		template<typename Escape>
+			constexpr bool is_default_escape(Escape)
+			{
+				return false;
+			}
+
+		template<typename Context, typename Enable = void>
+			struct has_escape_t: std::false_type {}; // e.g. length_context_t
+
+		template<typename Context>
+			struct has_escape_t<Context, decltype(void(std::declval<Context&>().escape(std::declval<const std::string&>())))>: std::true_type {};
+
+		template<typename Context, typename Enable = void>
+			struct inherits_default_escape_t: std::false_type {}; // also for overloaded escape() functions
+
+		template<typename Context>
+			struct inherits_default_escape_t<Context, decltype(void(&Context::escape))>:
+			std::integral_constant<bool, is_default_escape(&Context::escape)> {};
+
+		template<typename Context>
+			struct has_default_escape_t:
+			std::integral_constant<bool, not has_escape_t<Context>::value or inherits_default_escape_t<Context>::value> {};
+
+		// Contexts derived from serializer_context_t escape directly into their buffer,
+		// other contexts (and those with their own escape()) are asked to escape() into a temporary
+		template<typename Context>
+			auto serialize_escaped(const std::string& s, Context& context, int)
+			-> typename std::enable_if<has_default_escape_t<Context>::value, decltype(context.append_escaped(s), void())>::type
+			{
+				context.append_escaped(s);
+			}
+
+		template<typename Context>
+			void serialize_escaped(const std::string& s, Context& context, long)
+			{
+				context << context.escape(s);
+			}
+
+		template<typename Context>
+			void serialize_escaped(const std::string& s, Context& context)
+			{
+				serialize_escaped(s, context, 0);
+			}
+
+		// Contexts in auto parameterize mode take the literal's value and serialize a placeholder instead
+		template<typename T, typename Context>
+			auto parameterize_literal(const T& value, Context& context, int)
+			-> decltype(bool(context._parameterize_literal(value)))
+			{
+				return context._parameterize_literal(value);
+			}
+
+		template<typename T, typename Context>
+			bool parameterize_literal(const T&, Context&, long)
+			{
+				return false;
+			}
+
+		template<typename T, typename Context>
+			bool parameterize_literal(const T& value, Context& context)
+			{
+				return parameterize_literal(value, context, 0);
+			}
+
+		// Literal values call these around their text, contexts may ignore them
+		template<typename Context>
+			auto begin_literal(Context& context, int)
+			-> decltype(context._begin_literal(), void())
+			{
+				context._begin_literal();
+			}
+
+		template<typename Context>
+			void begin_literal(Context&, long)
+			{
+			}
+
+		template<typename Context>
+			void begin_literal(Context& context)
+			{
+				begin_literal(context, 0);
+			}
+
+		template<typename Context>
+			auto end_literal(Context& context, int)
+			-> decltype(context._end_literal(), void())
+			{
+				context._end_literal();
+			}
+
+		template<typename Context>
+			void end_literal(Context&, long)
+			{
+			}
+
+		template<typename Context>
+			void end_literal(Context& context)
+			{
+				end_literal(context, 0);
+			}
+	}
 }
 
 #endif
-
@@ -27,6 +27,7 @@
 #ifndef SQLPP_SINGLE_TABLE_H
 #define SQLPP_SINGLE_TABLE_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/no_value.h>
 #include <sqlpp11/no_data.h>
@@ -40,7 +41,7 @@ namespace sqlpp
 	template<typename Database, typename Table>
 		struct single_table_data_t
 		{
-			single_table_data_t(Table table):
+			constexpr single_table_data_t(Table table):
 				_table(table)
 			{}
 
@@ -85,7 +86,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return from; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.from)
+						static constexpr auto _get_member(T& t) -> decltype((t.from))
 						{
 							return t.from;
 						}
@@ -127,7 +128,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_from; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_from)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_from))
 					{
 						return t.no_from;
 					}
@@ -143,10 +144,17 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto from(Args... args)
+					constexpr auto from(Args... args) const &
 					-> _new_statement_t<single_table_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), single_table_data_t<void, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), single_table_data_t<void, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto from(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<single_table_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), single_table_data_t<void, Args...>{std::move(args)...} };
 					}
 			};
 	};
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SQLPP_SKELETON_H
+#define SQLPP_SKELETON_H
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <sqlpp11/type_traits.h>
+#include <sqlpp11/serializer.h>
+#include <sqlpp11/serialize.h>
+#include <sqlpp11/static_text.h>
+#include <sqlpp11/wrap_operand.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// The context has to be able to tell where the literals are, see serializer_context_t::_begin_literal(),
+		// and to drop the text of a failed splice, see serializer_context_t::truncate()
+		template<typename Context, typename Enable = void>
+			struct can_record_literals_impl: std::false_type {};
+
+		template<typename Context>
+			struct can_record_literals_impl<Context, typename std::enable_if<
+			std::is_same<decltype(std::declval<Context&>()._literal_offsets), std::vector<std::size_t>*>::value,
+			decltype(std::declval<Context&>().truncate(std::declval<Context&>().size()))>::type>: std::true_type {};
+
+		// Types with traits can tell if they contain literals, others (like policy data) have to be inspected
+		template<typename T, typename Enable = void>
+			struct may_contain_literals_impl: std::true_type {};
+
+		template<typename T>
+			struct may_contain_literals_impl<T, typename std::conditional<false, typename T::_recursive_traits::_tags, void>::type>:
+			std::integral_constant<bool, contains_runtime_data_t<T>::value> {};
+	}
+
+	// If runtime data only shows up as literal values, the text of an expression is fully determined
+	// by its type, except for the literals. Parameters are excluded for the same reasons as in static_text_t.
+	template<typename Context, typename T>
+		using can_use_skeleton_t = std::integral_constant<bool,
+					detail::is_string_context_impl<Context>::value
+					and detail::can_record_literals_impl<Context>::value
+					and contains_runtime_data_t<T>::value
+					and not contains_variable_shape_t<T>::value
+					and std::tuple_size<parameters_of<T>>::value == 0>;
+
+	// Walks an expression without producing text itself.
+	// Each literal value is written to the target context, preceded by the next text segment of the skeleton.
+	template<typename Context>
+		struct literal_collector_t
+		{
+			literal_collector_t(Context& context, const std::vector<std::string>& segments):
+				_context(context),
+				_segments(segments),
+				_next_segment(0),
+				_mismatch(false)
+			{}
+
+			template<typename T>
+				literal_collector_t& operator<<(const T&)
+				{
+					return *this;
+				}
+
+			literal_collector_t& operator<<(const char*)
+			{
+				return *this;
+			}
+
+			template<typename Operand>
+				void _literal(const Operand& operand)
+				{
+					if (_next_segment + 1 >= _segments.size())
+					{
+						_mismatch = true;
+						return;
+					}
+					_context << _segments[_next_segment++];
+					serializer_t<Context, Operand>::_(operand, _context);
+				}
+
+			void _finish()
+			{
+				if (_next_segment + 1 != _segments.size())
+				{
+					_mismatch = true;
+					return;
+				}
+				_context << _segments[_next_segment++];
+			}
+
+			Context& _context;
+			const std::vector<std::string>& _segments;
+			std::size_t _next_segment;
+			bool _mismatch;
+		};
+
+	namespace detail
+	{
+		template<typename T, typename Context>
+			literal_collector_t<Context>& collect_literals(const T& t, literal_collector_t<Context>& context, const std::true_type&)
+			{
+				serializer_t<literal_collector_t<Context>, T>::_(t, context);
+				return context;
+			}
+
+		template<typename T, typename Context>
+			literal_collector_t<Context>& collect_literals(const T&, literal_collector_t<Context>& context, const std::false_type&)
+			{
+				return context;
+			}
+	}
+
+	// Parts without runtime data contain no literals and are skipped entirely
+	template<typename T, typename Context>
+		literal_collector_t<Context>& serialize(const T& t, literal_collector_t<Context>& context)
+		{
+			return detail::collect_literals(t, context, detail::may_contain_literals_impl<T>{});
+		}
+
+	template<typename Context>
+		struct serializer_t<literal_collector_t<Context>, boolean_operand>
+		{
+			static literal_collector_t<Context>& _(const boolean_operand& t, literal_collector_t<Context>& context)
+			{
+				context._literal(t);
+				return context;
+			}
+		};
+
+	template<typename Context>
+		struct serializer_t<literal_collector_t<Context>, integral_operand>
+		{
+			static literal_collector_t<Context>& _(const integral_operand& t, literal_collector_t<Context>& context)
+			{
+				context._literal(t);
+				return context;
+			}
+		};
+
+	template<typename Context>
+		struct serializer_t<literal_collector_t<Context>, floating_point_operand>
+		{
+			static literal_collector_t<Context>& _(const floating_point_operand& t, literal_collector_t<Context>& context)
+			{
+				context._literal(t);
+				return context;
+			}
+		};
+
+	template<typename Context>
+		struct serializer_t<literal_collector_t<Context>, text_operand>
+		{
+			static literal_collector_t<Context>& _(const text_operand& t, literal_collector_t<Context>& context)
+			{
+				context._literal(t);
+				return context;
+			}
+		};
+
+	// Renders the text of T once per type (on first use) and remembers the text segments between the literals.
+	// Later serializations only write the segments and format the literals in between.
+	// The serializer is required to provide _serialize_parts() which must not use skeleton_t itself.
+	template<typename Context, typename T>
+		struct skeleton_t
+		{
+			static_assert(can_use_skeleton_t<Context, T>::value, "skeletons require a string context that records literals and an expression whose runtime data are literals");
+
+			struct _data_t
+			{
+				std::vector<std::string> _segments; // the text before, between and after the literals
+				bool _valid; // splicing reproduces the regular serialization
+			};
+
+			// Returns false if T's text cannot be produced from a skeleton, the context is left as it was then
+			static bool _serialize(const T& t, Context& context)
+			{
+				static const _data_t data = _render(t); // initialization is thread-safe
+				if (not data._valid)
+					return false;
+
+				const auto size = context.size();
+				if (_splice(t, data._segments, context))
+					return true;
+				context.truncate(size); // e.g. t has more or fewer literals than the instance the skeleton was rendered from
+				return false;
+			}
+
+		private:
+			static bool _splice(const T& t, const std::vector<std::string>& segments, Context& context)
+			{
+				literal_collector_t<Context> collector(context, segments);
+				serializer_t<literal_collector_t<Context>, T>::_serialize_parts(t, collector);
+				collector._finish();
+				return not collector._mismatch;
+			}
+
+			static _data_t _render(const T& t)
+			{
+				std::vector<std::size_t> offsets;
+				Context context;
+				context._literal_offsets = &offsets;
+				serializer_t<Context, T>::_serialize_parts(t, context);
+				context._literal_offsets = nullptr;
+				const std::string text = context.str();
+
+				_data_t data;
+				std::size_t begin = 0;
+				for (std::size_t i = 0; i + 1 < offsets.size(); i += 2)
+				{
+					data._segments.push_back(text.substr(begin, offsets[i] - begin));
+					begin = offsets[i + 1];
+				}
+				data._segments.push_back(text.substr(begin));
+
+				// Connectors might serialize parts of the statement differently, so the skeleton is only used
+				// if it reproduces the regular text
+				Context check;
+				data._valid = _splice(t, data._segments, check) and check.str() == text;
+				return data;
+			}
+		};
+}
+
+#endif
@@ -50,7 +50,7 @@ namespace sqlpp
 					};
 			};
 
-			some_t(Select select):
+			constexpr some_t(Select select):
 				_select(select)
 			{}
 
@@ -78,7 +78,7 @@ namespace sqlpp
 		};
 
 	template<typename T>
-		auto some(T t) -> some_t<wrap_operand_t<T>>
+		constexpr auto some(T t) -> some_t<wrap_operand_t<T>>
 		{
 			static_assert(is_select_t<wrap_operand_t<T>>::value, "some() requires a single column select expression as argument");
 			static_assert(is_expression_t<wrap_operand_t<T>>::value, "some() requires a single column select expression as argument");
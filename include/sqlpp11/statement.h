@@ -29,14 +29,21 @@
 
 #include <sqlpp11/result.h>
 #include <sqlpp11/parameter_list.h>
+#include <sqlpp11/dynamic_parameter_list.h>
 #include <sqlpp11/prepared_select.h>
 #include <sqlpp11/serialize.h>
 #include <sqlpp11/noop.h>
 #include <sqlpp11/policy_update.h>
 #include <sqlpp11/serializer.h>
+#include <sqlpp11/static_text.h>
+#include <sqlpp11/skeleton.h>
+#include <sqlpp11/length_context.h>
+#include <sqlpp11/fingerprint.h>
+#include <sqlpp11/monotonic_arena.h>
 
 #include <sqlpp11/detail/get_last.h>
 #include <sqlpp11/detail/pick_arg.h>
+#include <sqlpp11/detail/sum.h>
 
 namespace sqlpp
 {
@@ -61,6 +68,12 @@ namespace sqlpp
 				template<typename Needle, typename Replacement>
 					using _new_statement_t = typename _policies_update_t<Needle, Replacement>::type;
 
+				// Builder methods called on temporaries move the statement into the new one.
+				// Trivially destructible statements are left to the constexpr const& overloads instead,
+				// so that static statements can be built in constant expressions.
+				template<typename Statement, typename T>
+					using _rvalue_result_t = typename std::enable_if<not std::is_trivially_destructible<Statement>::value, T>::type;
+
 				using _all_required_tables = detail::make_joined_set_t<required_tables_of<Policies>...>;
 				using _all_provided_tables = detail::make_joined_set_t<provided_tables_of<Policies>...>;
 				using _all_extra_tables = detail::make_joined_set_t<extra_tables_of<Policies>...>;
@@ -110,15 +123,116 @@ namespace sqlpp
 					using _provided_tables = detail::type_set<>;
 					using _extra_tables = detail::type_set<>;
 					using _parameters = detail::make_parameter_tuple_t<parameters_of<Policies>...>;
+					using _tags = detail::make_joined_set_t<recursive_tags_of<Policies>...,
+								typename std::conditional<is_database<Db>::value, // dynamic parts are only known at runtime
+									detail::type_set<tag::contains_runtime_data, tag::contains_variable_shape>,
+									detail::type_set<>>::type>;
 				};
 			};
+
+		// A part of a statement, i.e. the named member of a policy (e.g. where) holding the policy's data.
+		// Parts without data (e.g. no_where_t or the statement name) take no storage: The statement derives from an
+		// empty stand-in instead, which hands out default constructed data for serialization and for new statements.
+		template<typename Policy, typename Policies, bool = std::is_empty<typename Policy::template _member_t<Policies>::_data_t>::value>
+			struct statement_part_t: public Policy::template _member_t<Policies>
+			{
+				using _member_t = typename Policy::template _member_t<Policies>;
+				using _impl_t = typename Policy::template _impl_t<Policies>;
+				using _data_t = typename _member_t::_data_t;
+
+				constexpr statement_part_t():
+					_member_t{}
+				{}
+
+				template<typename Statement, typename Term>
+					constexpr statement_part_t(Statement& statement, Term& term):
+						_member_t{_impl_t{pick_arg<statement_part_t>(statement, term)}}
+				{}
+
+				template<typename Statement>
+					static constexpr auto _get_data(Statement& statement) -> decltype((_member_t::_get_member(statement)._data))
+					{
+						return _member_t::_get_member(statement)._data;
+					}
+			};
+
+		template<typename Policy, typename Policies>
+			struct statement_part_t<Policy, Policies, true>
+			{
+				using _data_t = typename Policy::template _member_t<Policies>::_data_t;
+
+				constexpr statement_part_t()
+				{}
+
+				template<typename Statement, typename Term>
+					constexpr statement_part_t(Statement&, Term&)
+				{}
+
+				template<typename Statement>
+					static constexpr _data_t _get_data(Statement&)
+					{
+						return {};
+					}
+			};
+
+		template<typename Data>
+			auto bind_part_arena(Data& data, monotonic_arena_t* arena, int)
+			-> decltype(data._bind_arena(arena))
+			{
+				data._bind_arena(arena);
+			}
+
+		template<typename Data>
+			void bind_part_arena(Data&&, monotonic_arena_t*, long)
+			{}
+
+		// The arena for the dynamic parts of a statement, see dynamic_select(db, arena, ...).
+		// Static statements have no dynamic parts and do not store anything.
+		template<typename Db>
+			struct statement_arena_t
+			{
+				monotonic_arena_t* _arena = nullptr;
+
+				statement_arena_t() = default;
+
+				// Binds the dynamic parts of the (otherwise already constructed) statement to the arena
+				template<typename Statement>
+					statement_arena_t(monotonic_arena_t* arena, Statement& statement):
+						_arena(arena)
+				{
+					if (_arena)
+						Statement::_bind_arena(statement, _arena);
+				}
+
+				monotonic_arena_t* _get_arena() const
+				{
+					return _arena;
+				}
+			};
+
+		template<>
+			struct statement_arena_t<void>
+			{
+				constexpr statement_arena_t()
+				{}
+
+				template<typename Statement>
+					constexpr statement_arena_t(monotonic_arena_t*, Statement&)
+				{}
+
+				static constexpr monotonic_arena_t* _get_arena()
+				{
+					return nullptr;
+				}
+			};
 	}
 
 	template<typename Db,
 		typename... Policies
 			>
 			struct statement_t:
-				public Policies::template _member_t<detail::statement_policies_t<Db, Policies...>>...,
+				public detail::statement_part_t<Policies, detail::statement_policies_t<Db, Policies...>>...,
+				public detail::statement_arena_t<Db>,
 				public detail::statement_policies_t<Db, Policies...>::_value_type::template expression_operators<statement_t<Db, Policies...>>,
 				public detail::statement_policies_t<Db, Policies...>::_result_methods_t,
 				public Policies::template _methods_t<detail::statement_policies_t<Db, Policies...>>...
@@ -135,17 +249,26 @@ namespace sqlpp
 		using _name_t = typename _result_type_provider::_name_t;
 
 		// Constructors
-		statement_t()
+		constexpr statement_t():
+			detail::statement_part_t<Policies, _policies_t>{}...
 		{}
 
+		explicit statement_t(monotonic_arena_t& arena):
+			detail::statement_part_t<Policies, _policies_t>{}...,
+			detail::statement_arena_t<Db>(&arena, *this)
+		{
+			static_assert(is_database<Db>::value, "only dynamic statements can use an arena");
+		}
+
+		// The parts of statement and term are moved into the new statement, builder methods called on
+		// temporaries hand in the old statement as an rvalue, so chains of clauses do not copy their data.
 		template<typename Statement, typename Term>
-			statement_t(Statement statement, Term term):
-				Policies::template _member_t<_policies_t>{
-					typename Policies::template _impl_t<_policies_t>{
-						detail::pick_arg<typename Policies::template _member_t<_policies_t>>(statement, term)
-					}}...
-		//Policies::template _member_t<_policies_t>{{detail::pick_arg<typename Policies::template _member_t<_policies_t>>(statement, term)}}...
-		{}
+			constexpr statement_t(Statement statement, Term term):
+				detail::statement_part_t<Policies, _policies_t>(statement, term)...,
+				detail::statement_arena_t<Db>(statement._get_arena(), *this)
+		{
+			static_assert(detail::sum(std::is_same<typename detail::statement_part_t<Policies, _policies_t>::_data_t, Term>::value...) == 1, "the new term has to replace exactly one part of the statement");
+		}
 
 		statement_t(const statement_t& r) = default;
 		statement_t(statement_t&& r) = default;
@@ -160,7 +283,30 @@ namespace sqlpp
 
 		size_t _get_no_of_parameters() const
 		{
-			return _get_static_no_of_parameters();
+			return _get_static_no_of_parameters() + _get_dynamic_parameters()._get_no_of_occurrences();
+		}
+
+		// The parameters of dynamic parts, with the positions of all parameters in the statement text
+		dynamic_parameter_list_t _get_dynamic_parameters() const
+		{
+			return detail::make_dynamic_parameter_list(*this, is_database<Db>{});
+		}
+
+		// Identifies the shape of the statement, see fingerprint()
+		static constexpr uint64_t _get_static_fingerprint()
+		{
+			return detail::type_fingerprint<statement_t>::_get();
+		}
+
+		uint64_t _get_fingerprint() const
+		{
+			return fingerprint(*this);
+		}
+
+		static void _bind_arena(statement_t& statement, monotonic_arena_t* arena)
+		{
+			using swallow = int[];
+			(void) swallow{(detail::bind_part_arena(detail::statement_part_t<Policies, _policies_t>::_get_data(statement), arena, 0), 0)...};
 		}
 
 		static void _check_consistency()
@@ -181,10 +327,38 @@ namespace sqlpp
 			using P = ::sqlpp::detail::statement_policies_t<Database, Policies...>;
 
 			static Context& _(const T& t, Context& context)
+			{
+				return _serialize(t, context, can_use_static_text_t<Context, T>{}, can_use_skeleton_t<Context, T>{});
+			}
+
+			static Context& _serialize_parts(const T& t, Context& context)
 			{
 				using swallow = int[]; 
-				(void) swallow{(serialize(static_cast<const typename Policies::template _member_t<P>&>(t)()._data, context), 0)...};
+				(void) swallow{(serialize(::sqlpp::detail::statement_part_t<Policies, P>::_get_data(t), context), 0)...};
+
+				return context;
+			}
 
+		private:
+			static Context& _serialize(const T& t, Context& context, const std::true_type&, const std::false_type&)
+			{
+				context << static_text_t<Context, T>::_get(t);
+				return context;
+			}
+
+			static Context& _serialize(const T& t, Context& context, const std::false_type&, const std::true_type&)
+			{
+				if (skeleton_t<Context, T>::_serialize(t, context))
+					return context;
+				return _serialize(t, context, std::false_type{}, std::false_type{});
+			}
+
+			static Context& _serialize(const T& t, Context& context, const std::false_type&, const std::false_type&)
+			{
+				if (not detail::reserve_serialized_length(t, context))
+					return _serialize_parts(t, context);
+				_serialize_parts(t, context);
+				detail::remember_serialized_length<T>(context);
 				return context;
 			}
 		};
@@ -216,7 +390,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return statement_name; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.statement_name)
+						static constexpr auto _get_member(T& t) -> decltype((t.statement_name))
 						{
 							return t.statement_name;
 						}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_STATIC_TEXT_H
+#define SQLPP_STATIC_TEXT_H
+
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <sqlpp11/type_traits.h>
+#include <sqlpp11/serializer.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// A context can be used to render static text if we can create a fresh one and read its result
+		template<typename Context, typename Enable = void>
+			struct is_string_context_impl: std::false_type {};
+
+		template<typename Context>
+			struct is_string_context_impl<Context, typename std::enable_if<
+			std::is_default_constructible<Context>::value
+			and std::is_convertible<decltype(std::declval<const Context&>().str()), std::string>::value>::type>: std::true_type {};
+	}
+
+	// The text of an expression without runtime data and without parameters is fully determined by its type.
+	// Parameters are excluded since connectors might number them via the context.
+	template<typename Context, typename T>
+		using can_use_static_text_t = std::integral_constant<bool,
+					detail::is_string_context_impl<Context>::value
+					and not contains_runtime_data_t<T>::value
+					and std::tuple_size<parameters_of<T>>::value == 0>;
+
+	// Renders the text of T once per type (on first use) using T's serializer.
+	// The serializer is required to provide _serialize_parts() which must not use static_text_t itself.
+	template<typename Context, typename T>
+		struct static_text_t
+		{
+			static_assert(can_use_static_text_t<Context, T>::value, "static text requires a string context and an expression without runtime data");
+
+			static const std::string& _get(const T& t)
+			{
+				static const std::string text = _render(t); // initialization is thread-safe
+				return text;
+			}
+
+		private:
+			static std::string _render(const T& t)
+			{
+				Context context;
+				serializer_t<Context, T>::_serialize_parts(t, context);
+				return context.str();
+			}
+		};
+}
+
+#endif
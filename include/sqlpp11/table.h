@@ -50,6 +50,7 @@ namespace sqlpp
 			using _required_tables = detail::type_set<>;
 			using _provided_tables = detail::type_set<Table>;
 			using _extra_tables = detail::type_set<>;
+			using _tags = detail::type_set<>;
 		};
 
 		static_assert(sizeof...(ColumnSpec), "at least one column required per table");
@@ -60,42 +61,42 @@ namespace sqlpp
 
 
 		template<typename T>
-			join_t<inner_join_t, Table, T> join(T t)
+			constexpr join_t<inner_join_t, Table, T> join(T t) const
 			{
 				return { *static_cast<const Table*>(this), t };
 			}
 
 		template<typename T>
-			join_t<inner_join_t, Table, T> inner_join(T t)
+			constexpr join_t<inner_join_t, Table, T> inner_join(T t) const
 			{
 				return { *static_cast<const Table*>(this), t };
 			}
 
 		template<typename T>
-			join_t<outer_join_t, Table, T> outer_join(T t)
+			constexpr join_t<outer_join_t, Table, T> outer_join(T t) const
 			{
 				return { *static_cast<const Table*>(this), t };
 			}
 
 		template<typename T>
-			join_t<left_outer_join_t, Table, T> left_outer_join(T t)
+			constexpr join_t<left_outer_join_t, Table, T> left_outer_join(T t) const
 			{
 				return { *static_cast<const Table*>(this), t };
 			}
 
 		template<typename T>
-			join_t<right_outer_join_t, Table, T> right_outer_join(T t)
+			constexpr join_t<right_outer_join_t, Table, T> right_outer_join(T t) const
 			{
 				return { *static_cast<const Table*>(this), t };
 			}
 
 		template<typename AliasProvider>
-			_alias_t<AliasProvider> as(const AliasProvider&) const
+			constexpr _alias_t<AliasProvider> as(const AliasProvider&) const
 			{
 				return {*static_cast<const Table*>(this)};
 			}
 
-		const Table& ref() const
+		constexpr const Table& ref() const
 		{
 			return *static_cast<const Table*>(this);
 		}
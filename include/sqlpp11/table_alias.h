@@ -47,6 +47,7 @@ namespace sqlpp
 			using _required_tables = detail::type_set<>;
 			using _provided_tables = detail::type_set<AliasProvider>;
 			using _extra_tables = detail::type_set<>;
+			using _tags = recursive_tags_of<Table>;
 		};
 
 		static_assert(required_tables_of<Table>::size::value == 0, "table aliases must not depend on external tables");
@@ -54,7 +55,7 @@ namespace sqlpp
 		using _name_t = typename AliasProvider::_name_t;
 		using _column_tuple_t = std::tuple<column_t<Table, ColumnSpec>...>;
 
-		table_alias_t(Table table):
+		constexpr table_alias_t(Table table):
 			_table(table)
 		{}
 
@@ -28,9 +28,13 @@
 #define SQLPP_TEXT_H
 
 #include <cassert>
+#include <string>
+#include <vector>
 #include <sqlpp11/basic_expression_operators.h>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/exception.h>
+#include <sqlpp11/text_view.h>
+#include <sqlpp11/detail/null_bitmap.h>
 #include <sqlpp11/concat.h>
 #include <sqlpp11/like.h>
 
@@ -116,7 +120,7 @@ namespace sqlpp
 						_len = 0;
 					}
 
-					bool operator==(const _cpp_value_type& rhs) const { return value() == rhs; }
+					bool operator==(const _cpp_value_type& rhs) const { return view() == text_view_t(rhs); }
 					bool operator!=(const _cpp_value_type& rhs) const { return not operator==(rhs); }
 
 					bool is_null() const
@@ -129,6 +133,12 @@ namespace sqlpp
 					}
 
 					_cpp_value_type value() const
+					{
+						return view().str();
+					}
+
+					// Does not copy the text, the view is valid until the next row is fetched
+					text_view_t view() const
 					{
 						const bool null_value = _value_ptr == nullptr and not NullIsTrivial and not connector_null_result_is_trivial_value_t<Db>::value;
 						if (connector_assert_result_validity_t<Db>::value)
@@ -144,9 +154,9 @@ namespace sqlpp
 								throw exception("accessing value of NULL field");
 						}
 						if (_value_ptr) 
-							return std::string(_value_ptr, _value_ptr + _len);
+							return {_value_ptr, _len};
 						else
-							return "";
+							return {};
 					}
 
 					operator _cpp_value_type() const { return value(); }
@@ -163,6 +173,44 @@ namespace sqlpp
 					size_t _len;
 				};
 
+			// A column of a result batch, see result_batch_t.
+			// The text of row i is data[offsets[i], offsets[i + 1]), NULL values are empty.
+			template<typename Db>
+				struct _result_column_t
+				{
+					using _value_type = text;
+
+					bool is_null(size_t i) const
+					{
+						return _null_bitmap.is_null(i);
+					}
+
+					// Does not copy the text, the view is valid until the next batch is fetched
+					text_view_t operator[](size_t i) const
+					{
+						return {_data.data() + _offsets[i], _offsets[i + 1] - _offsets[i]};
+					}
+
+					void _resize(size_t capacity)
+					{
+						_offsets.resize(capacity + 1);
+						_null_bitmap._resize(capacity);
+					}
+
+					template<typename Target>
+						void _bind(Target& target, size_t index)
+						{
+							_null_bitmap._clear();
+							_data.clear();
+							target._bind_text_result_array(index, _offsets.data(), &_data, _null_bitmap.data(), _offsets.size() - 1);
+						}
+
+				private:
+					std::vector<size_t> _offsets;
+					std::string _data;
+					null_bitmap_t _null_bitmap;
+				};
+
 			template<typename T>
 				struct _is_valid_operand
 				{
@@ -176,7 +224,7 @@ namespace sqlpp
 				struct expression_operators: public basic_expression_operators<Base, is_text_t>
 			{
 				template<typename T>
-					concat_t<Base, wrap_operand_t<T>> operator+(T t) const
+					constexpr concat_t<Base, wrap_operand_t<T>> operator+(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 						static_assert(_is_valid_operand<rhs>::value, "invalid rhs operand");
@@ -185,7 +233,7 @@ namespace sqlpp
 					}
 
 				template<typename T>
-					like_t<Base, wrap_operand_t<T>> like(T t) const
+					constexpr like_t<Base, wrap_operand_t<T>> like(T t) const
 					{
 						using rhs = wrap_operand_t<T>;
 						static_assert(_is_valid_operand<rhs>::value, "invalid argument for like()");
@@ -198,7 +246,7 @@ namespace sqlpp
 				struct column_operators
 				{
 					template<typename T>
-						auto operator +=(T t) const -> assignment_t<Base, concat_t<Base, wrap_operand_t<T>>>
+						constexpr auto operator +=(T t) const -> assignment_t<Base, concat_t<Base, wrap_operand_t<T>>>
 						{
 							using rhs = wrap_operand_t<T>;
 							static_assert(_is_valid_operand<rhs>::value, "invalid rhs assignment operand");
@@ -211,7 +259,7 @@ namespace sqlpp
 		template<typename Db, bool TrivialIsNull>
 			inline std::ostream& operator<<(std::ostream& os, const text::_result_entry_t<Db, TrivialIsNull>& e)
 			{
-				return os << e.value();
+				return os << e.view();
 			}
 	}
 
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_TEXT_VIEW_H
+#define SQLPP_TEXT_VIEW_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+namespace sqlpp
+{
+	// A non-owning view of text, e.g. of a text field in a result row (see text::_result_entry_t::view()).
+	// Similar to std::string_view, which is not available in C++11.
+	class text_view_t
+	{
+		const char* _data;
+		std::size_t _size;
+
+	public:
+		constexpr text_view_t():
+			_data(nullptr),
+			_size(0)
+		{}
+
+		constexpr text_view_t(const char* data, std::size_t size):
+			_data(data),
+			_size(size)
+		{}
+
+		text_view_t(const std::string& s):
+			_data(s.data()),
+			_size(s.size())
+		{}
+
+		text_view_t(const char* s):
+			_data(s),
+			_size(std::strlen(s))
+		{}
+
+		constexpr const char* data() const
+		{
+			return _data;
+		}
+
+		constexpr std::size_t size() const
+		{
+			return _size;
+		}
+
+		constexpr bool empty() const
+		{
+			return _size == 0;
+		}
+
+		constexpr const char* begin() const
+		{
+			return _data;
+		}
+
+		constexpr const char* end() const
+		{
+			return _data + _size;
+		}
+
+		constexpr char operator[](std::size_t i) const
+		{
+			return _data[i];
+		}
+
+		std::string str() const
+		{
+			return std::string(_data, _size);
+		}
+
+		explicit operator std::string() const
+		{
+			return str();
+		}
+
+		bool operator==(const text_view_t& rhs) const
+		{
+			return _size == rhs._size and (_size == 0 or std::memcmp(_data, rhs._data, _size) == 0);
+		}
+
+		bool operator!=(const text_view_t& rhs) const
+		{
+			return not operator==(rhs);
+		}
+	};
+
+	inline std::ostream& operator<<(std::ostream& os, const text_view_t& v)
+	{
+		return os.write(v.data(), static_cast<std::streamsize>(v.size()));
+	}
+}
+
+#endif
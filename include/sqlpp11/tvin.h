@@ -40,11 +40,14 @@ namespace sqlpp
 		struct tvin_t
 		{
 			using _traits = make_traits<value_type_of<Operand>, tag::expression>;
-			using _recursive_traits = make_recursive_traits<Operand>;
+			struct _recursive_traits: public make_recursive_traits<Operand>
+			{
+				using _tags = detail::make_joined_set_t<recursive_tags_of<Operand>, detail::type_set<tag::contains_variable_shape>>; // trivial values are serialized as NULL
+			};
 
 			using _operand_t = Operand;
 
-			tvin_t(Operand operand): 
+			constexpr tvin_t(Operand operand): 
 				_value(operand)
 			{}
 			tvin_t(const tvin_t&) = default;
@@ -83,7 +86,7 @@ namespace sqlpp
 				return false;
 			}
 
-			maybe_tvin_t(Operand operand): 
+			constexpr maybe_tvin_t(Operand operand): 
 				_value(operand)
 			{}
 			maybe_tvin_t(const maybe_tvin_t&) = default;
@@ -99,14 +102,14 @@ namespace sqlpp
 		struct maybe_tvin_t<tvin_t<Operand>>
 		{
 			using _traits = make_traits<value_type_of<Operand>, tag::expression>;
-			using _recursive_traits = make_recursive_traits<Operand>;
+			using _recursive_traits = typename tvin_t<Operand>::_recursive_traits;
 
 			bool _is_trivial() const
 			{
 				return _value._is_trivial();
 			};
 
-			maybe_tvin_t(tvin_t<Operand> operand): 
+			constexpr maybe_tvin_t(tvin_t<Operand> operand): 
 				_value(operand._value)
 			{}
 			maybe_tvin_t(const maybe_tvin_t&) = default;
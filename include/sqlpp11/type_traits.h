@@ -80,6 +80,14 @@ namespace sqlpp
 	template<typename T>\
 	struct connector_##name##_t: detail::connector_##name##_impl<T> {};
 
+#define SQLPP_RECURSIVE_TRAIT_GENERATOR(name) \
+	namespace tag\
+	{\
+		struct name{};\
+	};\
+	template<typename T>\
+	using name##_t = detail::is_element_of<tag::name, typename T::_recursive_traits::_tags>;
+
 	SQLPP_IS_VALUE_TRAIT_GENERATOR(boolean);
 	SQLPP_IS_VALUE_TRAIT_GENERATOR(integral);
 	SQLPP_IS_VALUE_TRAIT_GENERATOR(floating_point);
@@ -148,6 +156,10 @@ namespace sqlpp
 
 	SQLPP_CONNECTOR_TRAIT_GENERATOR(null_result_is_trivial_value);
 	SQLPP_CONNECTOR_TRAIT_GENERATOR(assert_result_validity);
+	SQLPP_CONNECTOR_TRAIT_GENERATOR(binds_result_once); // result protocol 2, see connector_api/bind_result.h
+
+	SQLPP_RECURSIVE_TRAIT_GENERATOR(contains_runtime_data); // the serialized text depends on values only known at runtime
+	SQLPP_RECURSIVE_TRAIT_GENERATOR(contains_variable_shape); // runtime data changes more than the literal values in the serialized text
 
 	template<typename Database>
 		using is_database = typename std::conditional<std::is_same<Database, void>::value, std::false_type, std::true_type>::type;
@@ -187,6 +199,12 @@ namespace sqlpp
 				using type = typename T::_recursive_traits::_parameters;
 			};
 
+		template<typename T>
+			struct recursive_tags_of_impl
+			{
+				using type = typename T::_recursive_traits::_tags;
+			};
+
 		template<typename T>
 			struct name_of_impl
 			{
@@ -217,6 +235,9 @@ namespace sqlpp
 	template<typename T>
 		using parameters_of = typename detail::parameters_of_impl<T>::type;
 
+	template<typename T>
+		using recursive_tags_of = typename detail::recursive_tags_of_impl<T>::type;
+
 	template<typename T>
 		using name_of = typename detail::name_of_impl<T>::type;
 
@@ -233,6 +254,17 @@ namespace sqlpp
 			using _provided_tables = detail::make_joined_set_t<provided_tables_of<Arguments>...>;
 			using _extra_tables = detail::make_joined_set_t<extra_tables_of<Arguments>...>;
 			using _parameters = detail::make_parameter_tuple_t<parameters_of<Arguments>...>;
+			using _tags = detail::make_joined_set_t<recursive_tags_of<Arguments>...>;
+		};
+
+	template<typename... Tags>
+		struct recursive_tags
+		{
+			using _required_tables = detail::type_set<>;
+			using _provided_tables = detail::type_set<>;
+			using _extra_tables = detail::type_set<>;
+			using _parameters = std::tuple<>;
+			using _tags = detail::type_set<Tags...>;
 		};
 
 }
@@ -71,7 +71,7 @@ namespace sqlpp
 					 {
 						 _statement_t::_check_consistency();
 
-						 return {{}, db.prepare_update(_get_statement())};
+						 return {{}, _get_statement()._get_dynamic_parameters(), db.prepare_update(_get_statement()), _get_statement()._get_fingerprint()};
 					 }
 			};
 	};
@@ -111,6 +111,13 @@ namespace sqlpp
 		{
 			return { blank_update_t<Database>().from(table) };
 		}
+
+	template<typename Database, typename Table>
+		auto dynamic_update(const Database&, monotonic_arena_t& arena, Table table)
+		-> decltype(blank_update_t<Database>(arena).from(table))
+		{
+			return { blank_update_t<Database>(arena).from(table) };
+		}
 }
 
 #endif
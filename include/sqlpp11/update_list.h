@@ -27,6 +27,7 @@
 #ifndef SQLPP_UPDATE_LIST_H
 #define SQLPP_UPDATE_LIST_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/detail/type_set.h>
 #include <sqlpp11/interpret_tuple.h>
@@ -38,8 +39,8 @@ namespace sqlpp
 	template<typename Database, typename... Assignments>
 		struct update_list_data_t
 		{
-			update_list_data_t(Assignments... assignments):
-				_assignments(assignments...)
+			constexpr update_list_data_t(Assignments... assignments):
+				_assignments(std::move(assignments)...)
 			{}
 
 			update_list_data_t(const update_list_data_t&) = default;
@@ -50,6 +51,11 @@ namespace sqlpp
 
 			std::tuple<Assignments...> _assignments;
 			interpretable_list_t<Database> _dynamic_assignments;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_assignments._bind_arena(arena);
+			}
 		};
 
 	// UPDATE ASSIGNMENTS
@@ -114,7 +120,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return assignments; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.assignments)
+						static constexpr auto _get_member(T& t) -> decltype((t.assignments))
 						{
 							return t.assignments;
 						}
@@ -154,7 +160,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_assignments; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_assignments)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_assignments))
 					{
 						return t.no_assignments;
 					}
@@ -170,24 +176,40 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Assignments>
-					auto set(Assignments... assignments)
+					constexpr auto set(Assignments... assignments) const &
 					-> _new_statement_t<update_list_t<void, Assignments...>>
 					{
 						static_assert(sizeof...(Assignments), "at least one assignment expression required in set()");
-						return _set_impl<void>(assignments...);
+						return _set_impl<void>(*static_cast<const typename Policies::_statement_t*>(this), assignments...);
+					}
+
+				template<typename... Assignments, typename Statement = typename Policies::_statement_t>
+					auto set(Assignments... assignments) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<update_list_t<void, Assignments...>>>
+					{
+						static_assert(sizeof...(Assignments), "at least one assignment expression required in set()");
+						return _set_impl<void>(std::move(*static_cast<typename Policies::_statement_t*>(this)), assignments...);
 					}
 
 				template<typename... Assignments>
-					auto dynamic_set(Assignments... assignments)
+					constexpr auto dynamic_set(Assignments... assignments) const &
 					-> _new_statement_t<update_list_t<_database_t, Assignments...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_set() must not be called in a static statement");
-						return _set_impl<_database_t>(assignments...);
+						return _set_impl<_database_t>(*static_cast<const typename Policies::_statement_t*>(this), assignments...);
+					}
+
+				template<typename... Assignments, typename Statement = typename Policies::_statement_t>
+					auto dynamic_set(Assignments... assignments) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<update_list_t<_database_t, Assignments...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_set() must not be called in a static statement");
+						return _set_impl<_database_t>(std::move(*static_cast<typename Policies::_statement_t*>(this)), assignments...);
 					}
 
 			private:
-				template<typename Database, typename... Assignments>
-					auto _set_impl(Assignments... assignments)
+				template<typename Database, typename Statement, typename... Assignments>
+					static constexpr auto _set_impl(Statement&& statement, Assignments... assignments)
 					-> _new_statement_t<update_list_t<Database, Assignments...>>
 					{
 						static_assert(not ::sqlpp::detail::has_duplicates<Assignments...>::value, "at least one duplicate argument detected in set()");
@@ -197,7 +219,7 @@ namespace sqlpp
 						using _column_required_tables = typename ::sqlpp::detail::make_joined_set<required_tables_of<typename Assignments::_column_t>...>::type;
 						static_assert(sizeof...(Assignments) ? (_column_required_tables::size::value == 1) : true, "set() contains assignments for columns from more than one table");
 
-						return { *static_cast<typename Policies::_statement_t*>(this), update_list_data_t<Database, Assignments...>{assignments...} };
+						return { std::forward<Statement>(statement), update_list_data_t<Database, Assignments...>{std::move(assignments)...} };
 					}
 			};
 	};
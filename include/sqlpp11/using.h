@@ -27,6 +27,7 @@
 #ifndef SQLPP_USING_H
 #define SQLPP_USING_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/interpretable_list.h>
 #include <sqlpp11/interpret_tuple.h>
@@ -39,8 +40,8 @@ namespace sqlpp
 	template<typename Database, typename... Tables>
 		struct using_data_t
 		{
-			using_data_t(Tables... tables):
-				_tables(tables...)
+			constexpr using_data_t(Tables... tables):
+				_tables(std::move(tables)...)
 			{}
 
 			using_data_t(const using_data_t&) = default;
@@ -51,6 +52,11 @@ namespace sqlpp
 
 			std::tuple<Tables...> _tables;
 			interpretable_list_t<Database> _dynamic_tables;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_tables._bind_arena(arena);
+			}
 		};
 
 	// USING
@@ -111,7 +117,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return using_; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.using_)
+						static constexpr auto _get_member(T& t) -> decltype((t.using_))
 						{
 							return t.using_;
 						}
@@ -152,7 +158,7 @@ namespace sqlpp
 				const _impl_t<Policies>& operator()() const { return no_using; }
 
 				template<typename T>
-					static auto _get_member(T t) -> decltype(t.no_using)
+					static constexpr auto _get_member(T& t) -> decltype((t.no_using))
 					{
 						return t.no_using;
 					}
@@ -168,18 +174,33 @@ namespace sqlpp
 				static void _check_consistency() {}
 
 				template<typename... Args>
-					auto using_(Args... args)
+					constexpr auto using_(Args... args) const &
 					-> _new_statement_t<using_t<void, Args...>>
 					{
-						return { *static_cast<typename Policies::_statement_t*>(this), using_data_t<void, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), using_data_t<void, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto using_(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<using_t<void, Args...>>>
+					{
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), using_data_t<void, Args...>{std::move(args)...} };
 					}
 
 				template<typename... Args>
-					auto dynamic_using(Args... args)
+					constexpr auto dynamic_using(Args... args) const &
 					-> _new_statement_t<using_t<_database_t, Args...>>
 					{
 						static_assert(not std::is_same<_database_t, void>::value, "dynamic_using must not be called in a static statement");
-						return { *static_cast<typename Policies::_statement_t*>(this), using_data_t<_database_t, Args...>{args...} };
+						return { *static_cast<const typename Policies::_statement_t*>(this), using_data_t<_database_t, Args...>{std::move(args)...} };
+					}
+
+				template<typename... Args, typename Statement = typename Policies::_statement_t>
+					auto dynamic_using(Args... args) &&
+					-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<using_t<_database_t, Args...>>>
+					{
+						static_assert(not std::is_same<_database_t, void>::value, "dynamic_using must not be called in a static statement");
+						return { std::move(*static_cast<typename Policies::_statement_t*>(this)), using_data_t<_database_t, Args...>{std::move(args)...} };
 					}
 			};
 	};
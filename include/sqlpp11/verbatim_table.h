@@ -50,6 +50,14 @@ namespace sqlpp
 	struct verbatim_table_t: public sqlpp::table_t<verbatim_table_t, detail::unusable_pseudo_column_t>
 	{
 		struct _name_t {};
+		struct _recursive_traits
+		{
+			using _parameters = std::tuple<>;
+			using _required_tables = detail::type_set<>;
+			using _provided_tables = detail::type_set<verbatim_table_t>;
+			using _extra_tables = detail::type_set<>;
+			using _tags = detail::type_set<tag::contains_runtime_data, tag::contains_variable_shape>;
+		};
 
 		verbatim_table_t(std::string representation):
 			_representation(representation)
@@ -27,6 +27,7 @@
 #ifndef SQLPP_WHERE_H
 #define SQLPP_WHERE_H
 
+#include <utility>
 #include <sqlpp11/type_traits.h>
 #include <sqlpp11/parameter_list.h>
 #include <sqlpp11/expression.h>
@@ -40,8 +41,8 @@ namespace sqlpp
 	template<typename Database, typename... Expressions>
 		struct where_data_t
 		{
-			where_data_t(Expressions... expressions):
-				_expressions(expressions...)
+			constexpr where_data_t(Expressions... expressions):
+				_expressions(std::move(expressions)...)
 			{}
 
 			where_data_t(const where_data_t&) = default;
@@ -52,6 +53,11 @@ namespace sqlpp
 
 			std::tuple<Expressions...> _expressions;
 			interpretable_list_t<Database> _dynamic_expressions;
+
+			void _bind_arena(monotonic_arena_t* arena)
+			{
+				_dynamic_expressions._bind_arena(arena);
+			}
 		};
 
 	// WHERE(EXPR)
@@ -117,7 +123,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return where; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.where)
+						static constexpr auto _get_member(T& t) -> decltype((t.where))
 						{
 							return t.where;
 						}
@@ -142,7 +148,7 @@ namespace sqlpp
 		struct where_t<void, bool>
 		{
 			using _traits = make_traits<no_value_t, ::sqlpp::tag::where>;
-			using _recursive_traits = make_recursive_traits<>;
+			using _recursive_traits = recursive_tags<::sqlpp::tag::contains_runtime_data, ::sqlpp::tag::contains_variable_shape>;
 
 			// Data
 			using _data_t = where_data_t<void, bool>;
@@ -165,7 +171,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return where; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.where)
+						static constexpr auto _get_member(T& t) -> decltype((t.where))
 						{
 							return t.where;
 						}
@@ -208,7 +214,7 @@ namespace sqlpp
 					const _impl_t<Policies>& operator()() const { return no_where; }
 
 					template<typename T>
-						static auto _get_member(T t) -> decltype(t.no_where)
+						static constexpr auto _get_member(T& t) -> decltype((t.no_where))
 						{
 							return t.no_where;
 						}
@@ -228,18 +234,33 @@ namespace sqlpp
 					}
 
 					template<typename... Args>
-						auto where(Args... args)
+						constexpr auto where(Args... args) const &
 						-> _new_statement_t<where_t<void, Args...>>
 						{
-							return { *static_cast<typename Policies::_statement_t*>(this), where_data_t<void, Args...>{args...} };
+							return { *static_cast<const typename Policies::_statement_t*>(this), where_data_t<void, Args...>{std::move(args)...} };
+						}
+
+					template<typename... Args, typename Statement = typename Policies::_statement_t>
+						auto where(Args... args) &&
+						-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<where_t<void, Args...>>>
+						{
+							return { std::move(*static_cast<typename Policies::_statement_t*>(this)), where_data_t<void, Args...>{std::move(args)...} };
 						}
 
 					template<typename... Args>
-						auto dynamic_where(Args... args)
+						constexpr auto dynamic_where(Args... args) const &
 						-> _new_statement_t<where_t<_database_t, Args...>>
 						{
 							static_assert(not std::is_same<_database_t, void>::value, "dynamic_where must not be called in a static statement");
-							return { *static_cast<typename Policies::_statement_t*>(this), where_data_t<_database_t, Args...>{args...} };
+							return { *static_cast<const typename Policies::_statement_t*>(this), where_data_t<_database_t, Args...>{std::move(args)...} };
+						}
+
+					template<typename... Args, typename Statement = typename Policies::_statement_t>
+						auto dynamic_where(Args... args) &&
+						-> typename Policies::template _rvalue_result_t<Statement, _new_statement_t<where_t<_database_t, Args...>>>
+						{
+							static_assert(not std::is_same<_database_t, void>::value, "dynamic_where must not be called in a static statement");
+							return { std::move(*static_cast<typename Policies::_statement_t*>(this)), where_data_t<_database_t, Args...>{std::move(args)...} };
 						}
 				};
 		};
@@ -28,6 +28,10 @@
 #define SQLPP_DETAIL_WRAP_OPERAND_H
 
 #include <string>
+#include <utility>
+#include <sqlpp11/serializer_context.h>
+#include <sqlpp11/length_context.h>
+#include <sqlpp11/detail/number_format.h>
 #include <sqlpp11/serializer.h>
 #include <sqlpp11/type_traits.h>
 
@@ -44,15 +48,15 @@ namespace sqlpp
 	struct boolean_operand
 	{
 		using _traits = make_traits<::sqlpp::detail::boolean, ::sqlpp::tag::expression, ::sqlpp::tag::wrapped_value>;
-		using _recursive_traits = make_recursive_traits<>;
+		using _recursive_traits = recursive_tags<::sqlpp::tag::contains_runtime_data>;
 
 		using _value_t = bool;
 
-		boolean_operand():
+		constexpr boolean_operand():
 			_t{}
 		{}
 
-		boolean_operand(_value_t t):
+		constexpr boolean_operand(_value_t t):
 			_t(t)
 		{}
 
@@ -74,7 +78,17 @@ namespace sqlpp
 
 			static Context& _(const Operand& t, Context& context)
 			{
-				context << t._t;
+				return _value(t._t, context);
+			}
+
+			// Serializes a plain value as if it had been wrapped
+			static Context& _value(const Operand::_value_t& t, Context& context)
+			{
+				if (detail::parameterize_literal(t, context))
+					return context;
+				detail::begin_literal(context);
+				context << t;
+				detail::end_literal(context);
 				return context;
 			}
 		};
@@ -82,15 +96,15 @@ namespace sqlpp
 	struct integral_operand
 	{
 		using _traits = make_traits<::sqlpp::detail::integral, ::sqlpp::tag::expression, ::sqlpp::tag::wrapped_value>;
-		using _recursive_traits = make_recursive_traits<>;
+		using _recursive_traits = recursive_tags<::sqlpp::tag::contains_runtime_data>;
 
 		using _value_t = int64_t;
 
-		integral_operand():
+		constexpr integral_operand():
 			_t{}
 		{}
 
-		integral_operand(_value_t t):
+		constexpr integral_operand(_value_t t):
 			_t(t)
 		{}
 
@@ -112,7 +126,28 @@ namespace sqlpp
 
 			static Context& _(const Operand& t, Context& context)
 			{
-				context << t._t;
+				return _value(t._t, context);
+			}
+
+			// Serializes a plain value as if it had been wrapped
+			static Context& _value(const Operand::_value_t& t, Context& context)
+			{
+				if (detail::parameterize_literal(t, context))
+					return context;
+				detail::begin_literal(context);
+				char buffer[detail::number_buffer_size];
+				context << detail::integral_to_chars(t, buffer);
+				detail::end_literal(context);
+				return context;
+			}
+		};
+
+	template<>
+		struct serializer_t<length_context_t, integral_operand>
+		{
+			static length_context_t& _(const integral_operand&, length_context_t& context)
+			{
+				context._length += detail::max_integral_length;
 				return context;
 			}
 		};
@@ -121,15 +156,15 @@ namespace sqlpp
 	struct floating_point_operand
 	{
 		using _traits = make_traits<::sqlpp::detail::floating_point, ::sqlpp::tag::expression, ::sqlpp::tag::wrapped_value>;
-		using _recursive_traits = make_recursive_traits<>;
+		using _recursive_traits = recursive_tags<::sqlpp::tag::contains_runtime_data>;
 
 		using _value_t = double;
 
-		floating_point_operand():
+		constexpr floating_point_operand():
 			_t{}
 		{}
 
-		floating_point_operand(_value_t t):
+		constexpr floating_point_operand(_value_t t):
 			_t(t)
 		{}
 
@@ -151,7 +186,28 @@ namespace sqlpp
 
 			static Context& _(const Operand& t, Context& context)
 			{
-				context << t._t;
+				return _value(t._t, context);
+			}
+
+			// Serializes a plain value as if it had been wrapped
+			static Context& _value(const Operand::_value_t& t, Context& context)
+			{
+				if (detail::parameterize_literal(t, context))
+					return context;
+				detail::begin_literal(context);
+				char buffer[detail::number_buffer_size];
+				context << detail::floating_point_to_chars(t, buffer);
+				detail::end_literal(context);
+				return context;
+			}
+		};
+
+	template<>
+		struct serializer_t<length_context_t, floating_point_operand>
+		{
+			static length_context_t& _(const floating_point_operand&, length_context_t& context)
+			{
+				context._length += detail::max_floating_point_length;
 				return context;
 			}
 		};
@@ -159,7 +215,7 @@ namespace sqlpp
 	struct text_operand
 	{
 		using _traits = make_traits<::sqlpp::detail::text, ::sqlpp::tag::expression, ::sqlpp::tag::wrapped_value>;
-		using _recursive_traits = make_recursive_traits<>;
+		using _recursive_traits = recursive_tags<::sqlpp::tag::contains_runtime_data>;
 
 		using _value_t = std::string;
 
@@ -168,7 +224,7 @@ namespace sqlpp
 		{}
 
 		text_operand(_value_t t):
-			_t(t)
+			_t(std::move(t))
 		{}
 
 		text_operand(const text_operand&) = default;
@@ -189,7 +245,19 @@ namespace sqlpp
 
 			static Context& _(const Operand& t, Context& context)
 			{
-				context << '\'' << context.escape(t._t) << '\'';
+				return _value(t._t, context);
+			}
+
+			// Serializes a plain value as if it had been wrapped
+			static Context& _value(const Operand::_value_t& t, Context& context)
+			{
+				if (detail::parameterize_literal(t, context))
+					return context;
+				detail::begin_literal(context);
+				context << '\'';
+				detail::serialize_escaped(t, context);
+				context << '\'';
+				detail::end_literal(context);
 				return context;
 			}
 		};
@@ -229,6 +297,35 @@ namespace sqlpp
 	template<typename T>
 		using wrap_operand_t = typename wrap_operand<T>::type;
 
+	namespace detail
+	{
+		template<typename T>
+			using is_converted_text_t = std::integral_constant<bool, std::is_same<wrap_operand_t<T>, text_operand>::value
+			and not std::is_same<T, text_operand::_value_t>::value>;
+
+		// Serializes a plain value without constructing the wrapping operand, if the operand's serializer allows it
+		// and the value does not have to be converted to a temporary string
+		template<typename T, typename Context>
+			auto serialize_operand_value(const T& value, Context& context, int)
+			-> typename std::enable_if<not is_converted_text_t<T>::value, decltype(serializer_t<Context, wrap_operand_t<T>>::_value(value, context), void())>::type
+			{
+				serializer_t<Context, wrap_operand_t<T>>::_value(value, context);
+			}
+
+		template<typename T, typename Context>
+			void serialize_operand_value(const T& value, Context& context, long)
+			{
+				temporary_text_guard_t<Context> guard(context);
+				serializer_t<Context, wrap_operand_t<T>>::_(wrap_operand_t<T>{value}, context);
+			}
+
+		template<typename T, typename Context>
+			void serialize_operand_value(const T& value, Context& context)
+			{
+				serialize_operand_value(value, context, 0);
+			}
+	}
+
 }
 
 #endif
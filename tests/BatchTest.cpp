@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Sample.h"
+#include "MockDb.h"
+#include "is_regular.h"
+#include <sqlpp11/batch.h>
+#include <sqlpp11/parameter.h>
+#include <iostream>
+
+MockDb db;
+MockDb::_serializer_context_t printer;
+
+int main()
+{
+	test::TabBar t;
+
+	{
+		using T = sqlpp::batch_t<MockDb>;
+		static_assert(sqlpp::is_regular<T>::value, "type requirement");
+	}
+
+	auto b = sqlpp::batch(db,
+			insert_into(t).set(t.beta = "cheesecake"),
+			update(t).set(t.gamma = false).where(t.beta == "it's"),
+			remove_from(t).where(t.alpha == 17));
+	b.add(insert_into(t).set(t.beta = "kirschauflauf"));
+
+	const auto expected = std::string("INSERT  INTO tab_bar (beta) VALUES('cheesecake');")
+		+ "UPDATE tab_bar SET gamma=0 WHERE (tab_bar.beta='it''s');"
+		+ "DELETE FROM tab_bar WHERE (tab_bar.alpha=17);"
+		+ "INSERT  INTO tab_bar (beta) VALUES('kirschauflauf')";
+	if (serialize(b, printer).str() != expected)
+	{
+		std::cerr << "unexpected batch: " << printer.str() << std::endl;
+		return 1;
+	}
+
+	const auto counts = db(b);
+	if (counts.size() != b.size())
+	{
+		std::cerr << "expected one row count per statement" << std::endl;
+		return 1;
+	}
+
+	// Dynamic parameters are only found at runtime
+	{
+		auto r = dynamic_remove_from(db, t).dynamic_where();
+		r.where.add(t.alpha == sqlpp::parameter(t.alpha));
+		try
+		{
+			b.add(r);
+			std::cerr << "statements with dynamic parameters should be rejected" << std::endl;
+			return 1;
+		}
+		catch (const sqlpp::exception&)
+		{
+		}
+		if (b.size() != 4)
+		{
+			std::cerr << "a rejected statement should not be added" << std::endl;
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -33,6 +33,19 @@
 #include <iostream>
 
 MockDb db = {};
+
+struct copy_counting_vector_t: public std::vector<int>
+{
+	static int copies;
+
+	copy_counting_vector_t(std::initializer_list<int> values): std::vector<int>(values) {}
+	copy_counting_vector_t(const copy_counting_vector_t& rhs): std::vector<int>(rhs) { ++copies; }
+	copy_counting_vector_t(copy_counting_vector_t&&) = default;
+	copy_counting_vector_t& operator=(const copy_counting_vector_t&) = default;
+	copy_counting_vector_t& operator=(copy_counting_vector_t&&) = default;
+	~copy_counting_vector_t() = default;
+};
+int copy_counting_vector_t::copies = 0;
 SQLPP_ALIAS_PROVIDER(kaesekuchen);
 
 int main()
@@ -83,6 +96,18 @@ int main()
 		static_assert(not sqlpp::is_text_t<TT>::value, "type requirement");
 	}
 
+	// Test that value lists are moved, not copied, into in() and not_in()
+	{
+		copy_counting_vector_t::copies = 0;
+		auto in = t.alpha.in(sqlpp::value_list(copy_counting_vector_t({1, 2, 3})));
+		auto not_in = t.alpha.not_in(sqlpp::value_list(copy_counting_vector_t({1, 2, 3})));
+		if (copy_counting_vector_t::copies != 0 or std::get<0>(in._args)._container.size() != 3 or std::get<0>(not_in._args)._container.size() != 3)
+		{
+			std::cerr << "value lists should be moved into in(), got " << copy_counting_vector_t::copies << " copies" << std::endl;
+			return 1;
+		}
+	}
+
 	// Test not_in
 	{
 		using TI = decltype(t.alpha.not_in(1, 2, 3));
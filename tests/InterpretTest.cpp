@@ -31,8 +31,86 @@
 #include <sqlpp11/update.h>
 #include <sqlpp11/remove.h>
 #include <sqlpp11/functions.h>
+#include <sqlpp11/segmented_context.h>
 
 #include <iostream>
+#include <sstream>
+
+namespace
+{
+	struct chunking_context_t: public MockDb::_serializer_context_t
+	{
+		std::size_t _max_in_list_size() const { return 2; }
+	};
+
+	struct array_binding_context_t: public MockDb::_serializer_context_t
+	{
+		template<typename Container>
+			void _in_array(bool inverted, const Container& container)
+			{
+				*this << (inverted ? " <> ALL(?)" : " = ANY(?)");
+				_bound += container.size();
+			}
+
+		std::size_t _bound = 0;
+	};
+
+	// e.g. a connector that uses the escape function of its driver
+	struct backslash_escaping_context_t: public MockDb::_serializer_context_t
+	{
+		static std::string escape(const std::string& arg)
+		{
+			std::string result;
+			for (const auto c : arg)
+			{
+				if (c == '\'' or c == '\\')
+					result.push_back('\\');
+				result.push_back(c);
+			}
+			return result;
+		}
+	};
+
+	// fully static statements can be constant expressions
+	constexpr test::TabBar constexpr_tab = {};
+	constexpr auto constexpr_select = select(constexpr_tab.alpha).from(constexpr_tab).where(constexpr_tab.alpha > 3 and constexpr_tab.gamma == true).order_by(constexpr_tab.alpha.desc()).limit(10);
+	constexpr auto constexpr_remove = remove_from(constexpr_tab).where(constexpr_tab.alpha.is_null());
+}
+
+namespace
+{
+	// The number of literals is only known at runtime, i.e. skeletons rendered from one instance do not fit all others
+	struct varying_literals_t
+	{
+		using _traits = sqlpp::make_traits<sqlpp::no_value_t, sqlpp::tag::expression>;
+		using _recursive_traits = sqlpp::recursive_tags<sqlpp::tag::contains_runtime_data>;
+
+		int _count;
+	};
+}
+
+namespace sqlpp
+{
+	template<typename Context>
+		struct serializer_t<Context, varying_literals_t>
+		{
+			static Context& _(const varying_literals_t& t, Context& context)
+			{
+				return _serialize_parts(t, context);
+			}
+
+			static Context& _serialize_parts(const varying_literals_t& t, Context& context)
+			{
+				for (int i = 0; i < t._count; ++i)
+				{
+					if (i)
+						context << ',';
+					serialize(integral_operand{i}, context);
+				}
+				return context;
+			}
+		};
+}
 
 MockDb db = {};
 MockDb::_serializer_context_t printer;
@@ -161,5 +239,422 @@ int main()
 	serialize(select(all_of(t)).from(t).where(true), printer).str();
 	serialize(select(all_of(t)).from(t).where(false), printer).str();
 
+	// statements without runtime data are rendered once per type
+	{
+		using Context = MockDb::_serializer_context_t;
+		static_assert(sqlpp::can_use_static_text_t<Context, decltype(select(t.alpha, t.beta).from(t).where(t.gamma))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_static_text_t<Context, decltype(select(t.alpha).from(t).where(t.alpha == 7))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_static_text_t<Context, decltype(select(t.alpha).from(t).where(true))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_static_text_t<Context, decltype(select(t.alpha).from(t).where(t.alpha == parameter(t.alpha)))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_static_text_t<Context, decltype(dynamic_select(db, t.alpha).from(t).where(t.gamma))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_static_text_t<Context, decltype(select(t.alpha).from(select(t.alpha).from(t).where(t.alpha > 7).as(kaesekuchen)).where(t.gamma))>::value, "type requirement");
+
+		for (int i = 0; i < 2; ++i)
+		{
+			Context context;
+			serialize(select(t.alpha, t.beta).from(t).where(t.gamma), context);
+			if (context.str() != "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE tab_bar.gamma")
+			{
+				std::cerr << "unexpected static text: " << context.str() << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	// the deprecated stream constructor writes the text to the stream
+	{
+		std::ostringstream os;
+		{
+			sqlpp::serializer_context_t context(os);
+			serialize(t.alpha == 7, context);
+		}
+		std::ostringstream flushed;
+		sqlpp::serializer_context_t context(flushed);
+		serialize(t.alpha == 7, context);
+		const auto text = context.str();
+		context.flush();
+		if (os.str() != "(tab_bar.alpha=7)" or flushed.str() != text or text != os.str())
+		{
+			std::cerr << "unexpected stream text: " << os.str() << ", " << flushed.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// contexts with their own escape() are not bypassed by the quote doubling of serializer_context_t
+	{
+		static_assert(sqlpp::detail::has_default_escape_t<MockDb::_serializer_context_t>::value, "type requirement");
+		static_assert(not sqlpp::detail::has_default_escape_t<backslash_escaping_context_t>::value, "type requirement");
+		backslash_escaping_context_t context;
+		serialize(t.beta == "it's a \\", context);
+		if (context.str() != "(tab_bar.beta='it\\'s a \\\\')")
+		{
+			std::cerr << "unexpected escaped text: " << context.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// the context buffer grows beyond its inline capacity and escapes quotes
+	{
+		MockDb::_serializer_context_t context;
+		const std::string quoted = "it's " + std::string(300, 'x');
+		serialize(t.beta == quoted, context);
+		if (context.str() != "(tab_bar.beta='it''s " + std::string(300, 'x') + "')")
+		{
+			std::cerr << "unexpected text: " << context.str() << std::endl;
+			return 1;
+		}
+		context.reset();
+		serialize(t.beta == "'a''", context);
+		if (context.str() != "(tab_bar.beta='''a''''')")
+		{
+			std::cerr << "unexpected text: " << context.str() << std::endl;
+			return 1;
+		}
+		context.reset();
+		serialize(t.alpha == -42, context);
+		if (context.str() != "(tab_bar.alpha=-42)")
+		{
+			std::cerr << "unexpected text: " << context.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// statements whose runtime data are literals are spliced into a skeleton
+	{
+		using Context = MockDb::_serializer_context_t;
+		using S = decltype(select(t.alpha).from(t).where(t.alpha == 7 and t.beta == "x").limit(1));
+		static_assert(sqlpp::can_use_skeleton_t<Context, S>::value, "type requirement");
+		static_assert(sqlpp::can_use_skeleton_t<Context, decltype(update(t).set(t.delta = 7).where(t.alpha > 1.5))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_skeleton_t<Context, decltype(select(t.alpha).from(t).where(t.gamma))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_skeleton_t<Context, decltype(select(t.alpha).from(t).where(t.alpha == sqlpp::tvin(7)))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_skeleton_t<Context, decltype(select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(std::vector<int>{1, 2}))))>::value, "type requirement");
+		static_assert(not sqlpp::can_use_skeleton_t<Context, decltype(dynamic_select(db, t.alpha).from(t).where(t.alpha == 7))>::value, "type requirement");
+
+		// a splice that does not fit is rejected and leaves no text behind
+		{
+			using V = varying_literals_t;
+			Context context;
+			if (not sqlpp::skeleton_t<Context, V>::_serialize(V{2}, context) or context.str() != "0,1")
+			{
+				std::cerr << "unexpected skeleton text: " << context.str() << std::endl;
+				return 1;
+			}
+			context.reset();
+			context << "x";
+			if (sqlpp::skeleton_t<Context, V>::_serialize(V{3}, context) or sqlpp::skeleton_t<Context, V>::_serialize(V{1}, context)
+					or context.str() != "x")
+			{
+				std::cerr << "mismatching splices should be rejected: " << context.str() << std::endl;
+				return 1;
+			}
+		}
+
+		for (int i = 0; i < 3; ++i)
+		{
+			const std::string beta = i ? "it's" : "";
+			const auto s = select(t.alpha).from(t).where(t.alpha == i and t.beta == beta).limit(i + 1);
+			Context context;
+			if (not sqlpp::skeleton_t<Context, S>::_serialize(s, context))
+			{
+				std::cerr << "skeleton unexpectedly rejected" << std::endl;
+				return 1;
+			}
+			Context regular;
+			sqlpp::serializer_t<Context, S>::_serialize_parts(s, regular);
+			if (context.str() != regular.str())
+			{
+				std::cerr << "unexpected skeleton text: " << context.str() << " instead of " << regular.str() << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	// literals can be replaced by placeholders
+	{
+		for (int i = 0; i < 2; ++i)
+		{
+			sqlpp::literal_values_t values;
+			MockDb::_serializer_context_t context;
+			context.auto_parameterize(&values);
+			serialize(select(t.alpha).from(t).where(t.alpha == i and t.beta == "it's" and t.alpha.in(sqlpp::value_list(std::vector<double>{0.5, 1.5}))), context);
+			if (context.str() != "SELECT tab_bar.alpha FROM tab_bar WHERE (((tab_bar.alpha=?) AND (tab_bar.beta=?)) AND tab_bar.alpha IN(?,?))"
+					or values.size() != 4
+					or values[0]._type != sqlpp::literal_value_t::type_t::integral or values[0]._integral != i
+					or values[1]._type != sqlpp::literal_value_t::type_t::text or values[1]._text != "it's"
+					or values[3]._type != sqlpp::literal_value_t::type_t::floating_point or values[3]._floating_point != 1.5)
+			{
+				std::cerr << "unexpected auto parameterization: " << context.str() << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	// literal values can also be collected without producing text, e.g. for the keys of the prepared statement cache
+	{
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where(t.alpha == 7).limit(3);
+		s.where.add(t.beta == "it's");
+		s.where.add(t.alpha.in(sqlpp::value_list(std::vector<double>{0.5, 1.5})));
+		sqlpp::literal_values_t expected;
+		MockDb::_serializer_context_t context;
+		context.auto_parameterize(&expected);
+		serialize(s, context);
+		if (sqlpp::literal_values_of(s) != expected or expected.size() != 5)
+		{
+			std::cerr << "unexpected literal values: " << expected.size() << std::endl;
+			return 1;
+		}
+	}
+
+	// fingerprints identify the shape of statements, independent of literal values
+	{
+		using A = decltype(select(t.alpha).from(t).where(t.alpha == 1));
+		using B = decltype(select(t.beta).from(t).where(t.alpha == 1));
+		static_assert(A::_get_static_fingerprint() != B::_get_static_fingerprint(), "different statements should have different fingerprints");
+		const auto a1 = select(t.alpha).from(t).where(t.alpha == 1);
+		const auto a2 = select(t.alpha).from(t).where(t.alpha == 2);
+		if (a1._get_fingerprint() != a2._get_fingerprint() or a1._get_fingerprint() != A::_get_static_fingerprint())
+		{
+			std::cerr << "literal values must not change the fingerprint" << std::endl;
+			return 1;
+		}
+
+		auto d1 = dynamic_select(db).dynamic_columns(t.alpha).from(t).where(t.alpha == 1);
+		auto d2 = dynamic_select(db).dynamic_columns(t.alpha).from(t).where(t.alpha == 2);
+		const auto before = d1._get_fingerprint();
+		if (before != d2._get_fingerprint())
+		{
+			std::cerr << "literal values must not change the fingerprint of dynamic statements" << std::endl;
+			return 1;
+		}
+		d1.selected_columns.add(t.beta);
+		d2.selected_columns.add(t.gamma);
+		if (d1._get_fingerprint() == before or d1._get_fingerprint() == d2._get_fingerprint())
+		{
+			std::cerr << "dynamic parts have to change the fingerprint" << std::endl;
+			return 1;
+		}
+
+		// fingerprints depend on text, not on where it is stored (e.g. names merged across translation units or not)
+		{
+			const std::string keyword = " WHERE ";
+			sqlpp::fingerprint_context_t literal;
+			sqlpp::fingerprint_context_t copy;
+			literal << " WHERE ";
+			copy << keyword.c_str();
+			if (literal._hash != copy._hash)
+			{
+				std::cerr << "fingerprints must not depend on the address of text" << std::endl;
+				return 1;
+			}
+		}
+
+		// the fingerprint is taken from the runtime shape only: sizes of value lists, trivial values, dynamic parts
+		const std::vector<int> three = {1, 2, 3};
+		const std::vector<int> other_three = {4, 5, 6};
+		const std::vector<int> four = {1, 2, 3, 4};
+		const auto in_three = select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(three)))._get_fingerprint();
+		if (in_three != select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(other_three)))._get_fingerprint()
+				or in_three == select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(four)))._get_fingerprint()
+				or select(t.alpha).from(t).where(t.beta == sqlpp::tvin(""))._get_fingerprint()
+				== select(t.alpha).from(t).where(t.beta == sqlpp::tvin("cheesecake"))._get_fingerprint())
+		{
+			std::cerr << "value list sizes and trivial values have to change the fingerprint" << std::endl;
+			return 1;
+		}
+		auto w = dynamic_select(db, t.alpha).from(t).dynamic_where().dynamic_having();
+		auto h = w;
+		w.where.add(t.alpha == 1);
+		h.having.add(t.alpha == 1);
+		if (w._get_fingerprint() == h._get_fingerprint())
+		{
+			std::cerr << "the position of dynamic parts has to change the fingerprint" << std::endl;
+			return 1;
+		}
+	}
+
+	// the estimated length is an upper bound of the serialized length
+	{
+		auto i = insert_into(t).columns(t.delta, t.beta);
+		for (int k = 0; k < 100; ++k)
+			i.values.add(t.delta = -k, t.beta = "it's");
+		MockDb::_serializer_context_t context;
+		serialize(i, context);
+		const auto length = sqlpp::serialized_length(i);
+		if (length < context.size() or length > context.size() + 100 * sqlpp::detail::max_integral_length)
+		{
+			std::cerr << "unexpected length estimate: " << length << " for " << context.size() << std::endl;
+			return 1;
+		}
+	}
+
+	// large text values are referenced by segmented contexts instead of being copied
+	{
+		const std::string large = std::string(5000, 'x') + "'" + std::string(5000, 'y');
+		const auto u = update(t).set(t.beta = large).where(t.alpha == 7);
+		sqlpp::segmented_context_t context;
+		serialize(u, context);
+		const auto segments = context.segments();
+		if (segments.size() != 5
+				or (segments[1].data >= context.data() and segments[1].data < context.data() + context.size())
+				or segments[1].size != 5000 or segments[3].size != 5000
+				or std::string(segments[2].data, segments[2].size) != "''"
+				or context.str() != "UPDATE tab_bar SET beta='" + std::string(5000, 'x') + "''" + std::string(5000, 'y') + "' WHERE (tab_bar.alpha=7)")
+		{
+			std::cerr << "unexpected segments: " << segments.size() << std::endl;
+			return 1;
+		}
+	}
+
+	// text converted from other types only exists during serialization, segmented contexts copy it
+	{
+		const std::string large(5000, 'x');
+		const std::vector<const char*> values = {large.c_str(), "a"};
+		const auto s = select(t.alpha).from(t).where(t.beta.in(sqlpp::value_list(values)));
+		sqlpp::segmented_context_t context;
+		serialize(s, context);
+		if (context.segments().size() != 1 or context._borrow_threshold != 4096
+				or context.str() != "SELECT tab_bar.alpha FROM tab_bar WHERE tab_bar.beta IN('" + large + "','a')")
+		{
+			std::cerr << "unexpected segments for converted text: " << context.segments().size() << std::endl;
+			return 1;
+		}
+	}
+
+	// the owned buffer of a segmented context is not sized for the large text values it refers to
+	{
+		const std::string large(100000, 'x');
+		auto i = dynamic_insert_into(db, t).dynamic_set(t.beta = large); // dynamic statements are sized up front
+		i.insert_list.add(t.gamma = true);
+		sqlpp::segmented_context_t context;
+		serialize(i, context);
+		if (context.capacity() >= large.size() or context.total_size() != context.str().size()
+				or context.str() != "INSERT  INTO tab_bar (beta,gamma) VALUES('" + large + "',1)")
+		{
+			std::cerr << "unexpected owned buffer capacity: " << context.capacity() << std::endl;
+			return 1;
+		}
+	}
+
+	// long IN lists are split into groups or bound as an array, depending on the connector
+	{
+		const std::vector<int> ids = {1, 2, 3, 4, 5};
+		const std::vector<std::string> names = {"a", "b'"};
+		chunking_context_t context;
+		serialize(select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(std::cref(ids))) and t.beta.not_in(sqlpp::value_list(names.begin(), names.end()))), context);
+		if (context.str() != "SELECT tab_bar.alpha FROM tab_bar WHERE ((tab_bar.alpha IN(1,2) OR tab_bar.alpha IN(3,4) OR tab_bar.alpha IN(5)) AND tab_bar.beta NOT IN('a','b'''))")
+		{
+			std::cerr << "unexpected chunked IN: " << context.str() << std::endl;
+			return 1;
+		}
+
+		array_binding_context_t array_context;
+		serialize(select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(std::cref(ids)))), array_context);
+		if (array_context.str() != "SELECT tab_bar.alpha FROM tab_bar WHERE tab_bar.alpha = ANY(?)" or array_context._bound != ids.size())
+		{
+			std::cerr << "unexpected array IN: " << array_context.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// constexpr statements serialize like any other
+	{
+		MockDb::_serializer_context_t context;
+		serialize(constexpr_select, context);
+		context << ';';
+		serialize(constexpr_remove, context);
+		if (context.str() != "SELECT tab_bar.alpha FROM tab_bar WHERE ((tab_bar.alpha>3) AND (tab_bar.gamma=1)) ORDER BY tab_bar.alpha DESC LIMIT 10;DELETE FROM tab_bar WHERE tab_bar.alpha IS NULL")
+		{
+			std::cerr << "unexpected constexpr statements: " << context.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// entries of dynamic lists are separated, e.g. (a) AND (b) instead of (a)(b)
+	{
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where().dynamic_group_by().dynamic_having().dynamic_order_by();
+		s.where.add(t.alpha == 1);
+		s.where.add(t.beta == "a");
+		s.group_by.add(t.alpha);
+		s.group_by.add(t.beta);
+		s.having.add(t.alpha > 2);
+		s.having.add(t.alpha < 7);
+		s.order_by.add(t.alpha.asc());
+		s.order_by.add(t.beta.desc());
+
+		MockDb::_serializer_context_t context;
+		serialize(s, context);
+		if (context.str() != "SELECT tab_bar.alpha FROM tab_bar WHERE (tab_bar.alpha=1) AND (tab_bar.beta='a') GROUP BY tab_bar.alpha,tab_bar.beta HAVING (tab_bar.alpha>2) AND (tab_bar.alpha<7) ORDER BY tab_bar.alpha ASC,tab_bar.beta DESC")
+		{
+			std::cerr << "unexpected separators in dynamic lists: " << context.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// dynamic parts are separated and survive copies of the statement
+	{
+		auto s = dynamic_select(db).dynamic_columns(t.alpha).from(t).dynamic_where().dynamic_order_by();
+		s.selected_columns.add(t.beta);
+		s.where.add(t.alpha == 1);
+		s.where.add(t.beta == "it's " + std::string(100, 'x'));
+		s.where.add(t.beta == "a" or t.beta == "b"); // too large to be stored inline
+		s.order_by.add(t.alpha.asc());
+		s.order_by.add(t.beta.desc());
+		const auto copy = s;
+		{
+			const auto moved = std::move(s);
+		}
+
+		MockDb::_serializer_context_t context;
+		serialize(copy, context);
+		if (context.str() != "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE (tab_bar.alpha=1) AND (tab_bar.beta='it''s " + std::string(100, 'x') + "') AND ((tab_bar.beta='a') OR (tab_bar.beta='b')) ORDER BY tab_bar.alpha ASC,tab_bar.beta DESC")
+		{
+			std::cerr << "unexpected dynamic statement: " << context.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// dynamic parts allocated from an arena
+	{
+		sqlpp::monotonic_arena_t arena(64);
+		auto s = dynamic_select(db, arena).dynamic_columns(t.alpha).from(t).dynamic_where().dynamic_order_by();
+		s.selected_columns.add(t.beta);
+		for (int i = 0; i < 20; ++i)
+			s.where.add(t.alpha != i);
+		s.order_by.add(t.beta.desc());
+		auto copy = s;
+		copy.where.add(t.beta == "a" or t.beta == "b");
+
+		std::string conditions = "(tab_bar.alpha!=0)";
+		for (int i = 1; i < 20; ++i)
+			conditions += " AND (tab_bar.alpha!=" + std::to_string(i) + ")";
+		MockDb::_serializer_context_t context;
+		serialize(s, context);
+		MockDb::_serializer_context_t copy_context;
+		serialize(copy, copy_context);
+		if (context.str() != "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE " + conditions + " ORDER BY tab_bar.beta DESC"
+				or copy_context.str() != "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE " + conditions + " AND ((tab_bar.beta='a') OR (tab_bar.beta='b')) ORDER BY tab_bar.beta DESC"
+				or arena._get_no_of_blocks() < 2)
+		{
+			std::cerr << "unexpected dynamic statement using an arena: " << context.str() << " / " << copy_context.str() << std::endl;
+			return 1;
+		}
+
+		auto i = dynamic_insert_into(db, arena, t).dynamic_set();
+		i.insert_list.add(t.beta = "cheesecake");
+		auto u = dynamic_update(db, arena, t).dynamic_set().where(t.alpha == 7);
+		u.assignments.add(t.gamma = true);
+		auto r = dynamic_remove_from(db, arena, t).dynamic_where();
+		r.where.add(t.alpha == 7);
+		MockDb::_serializer_context_t other_context;
+		serialize(i, other_context) << "; ";
+		serialize(u, other_context) << "; ";
+		serialize(r, other_context);
+		if (other_context.str() != "INSERT  INTO tab_bar (beta) VALUES('cheesecake'); UPDATE tab_bar SET gamma=1 WHERE (tab_bar.alpha=7); DELETE FROM tab_bar WHERE (tab_bar.alpha=7)")
+		{
+			std::cerr << "unexpected dynamic statements using an arena: " << other_context.str() << std::endl;
+			return 1;
+		}
+	}
+
 	return 0;
 }
@@ -26,36 +26,18 @@
 #ifndef SQLPP_MOCK_DB_H
 #define SQLPP_MOCK_DB_H
 
-#include <sstream>
+#include <vector>
 #include <sqlpp11/serializer_context.h>
 #include <sqlpp11/connection.h>
+#include <sqlpp11/prepared_statement_cache.h>
 
-struct MockDb: public sqlpp::connection
+struct MockDb: public sqlpp::connection, public sqlpp::cached_prepare_t<MockDb>
 {
-	struct _serializer_context_t
-	{
-		std::ostringstream _os;
-
-		std::string str() const
-		{
-			return _os.str();
-		}
-
-		void reset()
-		{
-			_os.str("");
-		}
-
-		template<typename T>
-			std::ostream& operator<<(T t)
-			{
-				return _os << t;
-			}
+	// number of prepare_* calls, e.g. to check the prepared statement cache
+	size_t _prepare_calls = 0;
 
-		static std::string escape(std::string arg)
-		{
-			return sqlpp::serializer_context_t::escape(arg);
-		}
+	struct _serializer_context_t: public sqlpp::serializer_context_t
+	{
 	};
 
 	using _interpreter_context_t = _serializer_context_t;
@@ -87,6 +69,18 @@ struct MockDb: public sqlpp::connection
 			{
 				result_row._invalidate();
 			};
+
+		template<typename ResultBatch>
+			void next_batch(ResultBatch& batch)
+			{
+				batch._bind(*this);
+				batch._set_size(0);
+			}
+
+		void _bind_boolean_result_array(size_t, signed char*, unsigned char*, size_t) {}
+		void _bind_floating_point_result_array(size_t, double*, unsigned char*, size_t) {}
+		void _bind_integral_result_array(size_t, int64_t*, unsigned char*, size_t) {}
+		void _bind_text_result_array(size_t, size_t*, std::string*, unsigned char*, size_t) {}
 	};
 
 	// Directly executed statements start here
@@ -133,6 +127,7 @@ struct MockDb: public sqlpp::connection
 	template<typename Insert>
 		_prepared_statement_t prepare_insert(Insert& x)
 		{
+			++_prepare_calls;
 			return nullptr;
 		}
 
@@ -142,9 +137,36 @@ struct MockDb: public sqlpp::connection
 			return 0;
 		}
 
+	template<typename Update>
+		_prepared_statement_t prepare_update(Update& x)
+		{
+			++_prepare_calls;
+			return nullptr;
+		}
+
+	template<typename PreparedUpdate>
+		size_t run_prepared_update(const PreparedUpdate& x)
+		{
+			return 0;
+		}
+
+	template<typename Remove>
+		_prepared_statement_t prepare_remove(Remove& x)
+		{
+			++_prepare_calls;
+			return nullptr;
+		}
+
+	template<typename PreparedRemove>
+		size_t run_prepared_remove(const PreparedRemove& x)
+		{
+			return 0;
+		}
+
 	template<typename Select>
 		_prepared_statement_t prepare_select(Select& x)
 		{
+			++_prepare_calls;
 			return nullptr;
 		}
 
@@ -154,6 +176,15 @@ struct MockDb: public sqlpp::connection
 			return {};
 		}
 
+	// Batches
+	template<typename Batch>
+		std::vector<size_t> execute_batch(const Batch& b)
+		{
+			_serializer_context_t context;
+			sqlpp::serialize(b, context);
+			return std::vector<size_t>(b.size(), 0);
+		}
+
 };
 
 #endif
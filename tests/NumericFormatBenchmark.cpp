@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/insert.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/functions.h>
+#include <chrono>
+#include <clocale>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	long long micros_since(const clock_type::time_point& start)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - start).count();
+	}
+
+	// The way numbers used to be serialized: through std::ostream with default precision
+	template<typename Container>
+		std::size_t ostream_format(const Container& numbers)
+		{
+			std::ostringstream os;
+			for (const auto& n : numbers)
+				os << n << ',';
+			return os.str().size();
+		}
+
+	template<typename Container>
+		std::size_t buffer_format(const Container& numbers)
+		{
+			MockDb::_serializer_context_t context;
+			for (const auto& n : numbers)
+				context << n << ',';
+			return context.str().size();
+		}
+
+	// The IN list and the insert of the benchmark below, written to an std::ostream like they used to be serialized.
+	// The default precision of 6 digits is lossy, 17 digits round trip like serialize() but are not the shortest text.
+	template<typename Container>
+		std::string ostream_in_list(const std::string& column, const std::string& table, const Container& numbers, int precision = 6)
+		{
+			std::ostringstream os;
+			os.precision(precision);
+			os << "SELECT " << table << '.' << column << " FROM " << table << " WHERE " << table << '.' << column << " IN(";
+			bool first = true;
+			for (const auto& n : numbers)
+			{
+				if (first)
+					first = false;
+				else
+					os << ',';
+				os << n;
+			}
+			os << ')';
+			return os.str();
+		}
+
+	std::string ostream_insert(const std::vector<int64_t>& ints, const std::vector<double>& reals, int precision = 6)
+	{
+		std::ostringstream os;
+		os.precision(precision);
+		os << "INSERT  INTO tab_foo (epsilon,omega) VALUES ";
+		for (std::size_t i = 0; i < ints.size(); ++i)
+		{
+			if (i)
+				os << ',';
+			os << '(' << ints[i] << ',' << reals[i] << ')';
+		}
+		return os.str();
+	}
+
+	template<typename T>
+		std::string serialized(const T& t)
+		{
+			MockDb::_serializer_context_t context;
+			serialize(t, context);
+			return context.str();
+		}
+}
+
+int main()
+{
+	test::TabFoo f;
+	test::TabBar t;
+
+	// correctness
+	if (serialized(sqlpp::value(-9223372036854775807LL - 1)) != "-9223372036854775808"
+			or serialized(sqlpp::value(0)) != "0"
+			or serialized(sqlpp::value(1234567)) != "1234567"
+			or serialized(sqlpp::value(0.1)) != "0.1"
+			or serialized(sqlpp::value(-2.5)) != "-2.5")
+	{
+		std::cerr << "unexpected number formatting" << std::endl;
+		return 1;
+	}
+
+	// the baselines produce the same text as serialize() where the default precision of std::ostream is enough
+	{
+		const std::vector<int64_t> ints = {1, -2, 300};
+		const std::vector<double> reals = {0.5, -1.25, 3};
+		auto multi_insert = insert_into(f).columns(f.epsilon, f.omega);
+		for (std::size_t i = 0; i < ints.size(); ++i)
+			multi_insert.values.add(f.epsilon = ints[i], f.omega = reals[i]);
+		if (ostream_in_list("alpha", "tab_bar", ints) != serialized(select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(ints))))
+				or ostream_in_list("omega", "tab_foo", reals) != serialized(select(f.omega).from(f).where(f.omega.in(sqlpp::value_list(reals))))
+				or ostream_insert(ints, reals) != serialized(multi_insert))
+		{
+			std::cerr << "baselines differ from serialize(): " << ostream_insert(ints, reals) << std::endl;
+			return 1;
+		}
+	}
+
+	const std::vector<double> doubles = {0.1, 1.0 / 3.0, 2.0 / 3.0, 1e-300, 123456789.123456789, 3.141592653589793, -1.7976931348623157e308};
+	for (const auto d : doubles)
+	{
+		const auto text = serialized(sqlpp::value(d));
+		if (std::strtod(text.c_str(), nullptr) != d)
+		{
+			std::cerr << "double does not round trip: " << text << std::endl;
+			return 1;
+		}
+	}
+
+	if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8"))
+	{
+		const auto text = serialized(sqlpp::value(1.5));
+		std::setlocale(LC_NUMERIC, "C");
+		if (text != "1.5")
+		{
+			std::cerr << "locale dependent formatting: " << text << std::endl;
+			return 1;
+		}
+	}
+
+	// benchmark
+	const std::size_t count = 1000;
+	const int rounds = 20;
+	std::vector<int64_t> ints;
+	std::vector<double> reals;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		ints.push_back(static_cast<int64_t>(i * 7919 + 1000000));
+		reals.push_back(static_cast<double>(i) / 7.0);
+	}
+
+	std::size_t total = 0;
+	{
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+			total += ostream_format(ints);
+		std::cout << "ostream formatting of " << count << " integers: " << micros_since(start) / rounds << "us" << std::endl;
+	}
+	{
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+			total += buffer_format(ints);
+		std::cout << "buffer formatting of " << count << " integers: " << micros_since(start) / rounds << "us" << std::endl;
+	}
+	{
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+			total += ostream_format(reals);
+		std::cout << "ostream formatting of " << count << " doubles (6 digits, lossy): " << micros_since(start) / rounds << "us" << std::endl;
+	}
+	{
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+			total += buffer_format(reals);
+		std::cout << "buffer formatting of " << count << " doubles (round trip): " << micros_since(start) / rounds << "us" << std::endl;
+	}
+
+	{
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+		{
+			total += ostream_in_list("alpha", "tab_bar", ints, 6).size();
+			total += ostream_in_list("omega", "tab_foo", reals, 6).size();
+		}
+		std::cout << "ostream IN lists with " << count << " integers and doubles (6 digits, lossy): " << micros_since(start) / rounds << "us" << std::endl;
+	}
+	{
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+		{
+			total += ostream_in_list("alpha", "tab_bar", ints, 17).size();
+			total += ostream_in_list("omega", "tab_foo", reals, 17).size();
+		}
+		std::cout << "ostream IN lists with " << count << " integers and doubles (17 digits): " << micros_since(start) / rounds << "us" << std::endl;
+	}
+	{
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+		{
+			total += serialized(select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(ints)))).size();
+			total += serialized(select(f.omega).from(f).where(f.omega.in(sqlpp::value_list(reals)))).size();
+		}
+		std::cout << "serialized IN lists with " << count << " integers and doubles (shortest round trip): " << micros_since(start) / rounds << "us" << std::endl;
+	}
+
+	{
+		auto multi_insert = insert_into(f).columns(f.epsilon, f.omega);
+		for (std::size_t i = 0; i < count; ++i)
+			multi_insert.values.add(f.epsilon = ints[i], f.omega = reals[i]);
+
+		{
+			const auto start = clock_type::now();
+			for (int r = 0; r < rounds; ++r)
+				total += ostream_insert(ints, reals, 6).size();
+			std::cout << "ostream insert with " << count << " rows of integers and doubles (6 digits, lossy): " << micros_since(start) / rounds << "us" << std::endl;
+		}
+		{
+			const auto start = clock_type::now();
+			for (int r = 0; r < rounds; ++r)
+				total += ostream_insert(ints, reals, 17).size();
+			std::cout << "ostream insert with " << count << " rows of integers and doubles (17 digits): " << micros_since(start) / rounds << "us" << std::endl;
+		}
+
+		const auto start = clock_type::now();
+		for (int r = 0; r < rounds; ++r)
+			total += serialized(multi_insert).size();
+		std::cout << "serialized insert with " << count << " rows of integers and doubles (shortest round trip): " << micros_since(start) / rounds << "us" << std::endl;
+	}
+
+	return total ? 0 : 1;
+}
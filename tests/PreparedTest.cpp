@@ -28,11 +28,48 @@
 #include "is_regular.h"
 #include <sqlpp11/functions.h>
 #include <sqlpp11/select.h>
+#include <sqlpp11/update.h>
+#include <sqlpp11/remove.h>
 
 #include <iostream>
+#include <map>
 
 MockDb db = {};
 
+// Records the bound parameters by index, like a connector's prepared statement would bind them
+struct parameter_recorder_t
+{
+	std::map<size_t, std::string> _bindings;
+
+	void _bind_boolean_parameter(size_t index, const signed char* value, bool is_null)
+	{
+		_bindings[index] = is_null ? "NULL" : std::to_string(*value);
+	}
+
+	void _bind_floating_point_parameter(size_t index, const double* value, bool is_null)
+	{
+		_bindings[index] = is_null ? "NULL" : std::to_string(*value);
+	}
+
+	void _bind_integral_parameter(size_t index, const int64_t* value, bool is_null)
+	{
+		_bindings[index] = is_null ? "NULL" : std::to_string(*value);
+	}
+
+	void _bind_text_parameter(size_t index, const std::string* value, bool is_null)
+	{
+		_bindings[index] = is_null ? "NULL" : *value;
+	}
+
+	std::string str() const
+	{
+		std::string result;
+		for (const auto& binding : _bindings)
+			result += std::to_string(binding.first) + ":" + binding.second + " ";
+		return result;
+	}
+};
+
 int main()
 {
 	//test::TabFoo f; 
@@ -106,5 +143,130 @@ int main()
 		std::cerr << x.alpha << std::endl;
 	}
 
+	// Prepared statements carry the fingerprint of their statement
+	{
+		auto s = select(all_of(t)).from(t).where(t.alpha == parameter(t.alpha));
+		auto p = db.prepare(s);
+		static_assert(decltype(p)::_get_static_fingerprint() == decltype(s)::_get_static_fingerprint(), "fingerprints of prepared and original statement have to be equal");
+		if (p._get_fingerprint() != s._get_fingerprint())
+		{
+			std::cerr << "prepared statement has an unexpected fingerprint" << std::endl;
+			return 1;
+		}
+	}
+
+	// Prepared statements are cached by statement type and dynamic shape
+	{
+		const auto calls = db._prepare_calls;
+		auto s = select(all_of(t)).from(t).where(t.alpha == parameter(t.alpha));
+		auto p = db.prepare_cached(s);
+		p->params.alpha = 7;
+		db(*p);
+		if (db.prepare_cached(s) != p or db._prepare_calls != calls + 1)
+		{
+			std::cerr << "cached prepared statement has not been reused" << std::endl;
+			return 1;
+		}
+
+		auto d = dynamic_select(db, t.alpha).from(t).dynamic_where(t.alpha == parameter(t.alpha));
+		auto e = d;
+		e.where.add(t.beta == "cheesecake");
+		db.prepare_cached(d);
+		db.prepare_cached(d);
+		db.prepare_cached(e);
+		if (db._prepare_calls != calls + 3 or db._get_prepared_statement_cache().size() != 3)
+		{
+			std::cerr << "dynamic shapes should be cached separately" << std::endl;
+			return 1;
+		}
+
+		// Literals are part of the prepared text, so statements that differ only in literals are cached separately
+		const auto literal_calls = db._prepare_calls;
+		auto one = db.prepare_cached(select(t.alpha).from(t).where(t.alpha == 1));
+		auto two = db.prepare_cached(select(t.alpha).from(t).where(t.alpha == 2));
+		auto cheesecake = d;
+		cheesecake.where.add(t.beta == "cheesecake");
+		auto apple_pie = d;
+		apple_pie.where.add(t.beta == "apple pie");
+		auto cheesecake_prepared = db.prepare_cached(cheesecake);
+		auto apple_pie_prepared = db.prepare_cached(apple_pie);
+		if (one == two or cheesecake_prepared == apple_pie_prepared or db.prepare_cached(select(t.alpha).from(t).where(t.alpha == 1)) != one
+				or db._prepare_calls != literal_calls + 3)
+		{
+			std::cerr << "statements with different literals should be cached separately" << std::endl;
+			return 1;
+		}
+
+		size_t released = 0;
+		sqlpp::prepared_statement_cache_t<MockDb> cache(2, [&released](MockDb::_prepared_statement_t&) { ++released; });
+		auto held = cache.prepare(db, s);
+		cache.prepare(db, d);
+		cache.prepare(db, update(t).set(t.gamma = parameter(t.gamma)).where(true));
+		cache.prepare(db, remove_from(t).where(t.alpha == parameter(t.alpha)));
+		if (cache.size() != 2 or cache.misses() != 4 or released != 1)
+		{
+			std::cerr << "least recently used statements should have been evicted" << std::endl;
+			return 1;
+		}
+		held.reset();
+		cache.set_capacity(0);
+		if (cache.size() != 0 or released != 4)
+		{
+			std::cerr << "evicted statements should have been released" << std::endl;
+			return 1;
+		}
+	}
+
+	// Parameters in dynamic parts are bound at their position in the statement text
+	{
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where(t.alpha == parameter(t.alpha)).group_by(t.beta).having(t.beta.like(parameter(t.beta)));
+		s.where.add(t.gamma != parameter(t.gamma));
+		s.where.add(t.gamma == t.gamma or t.gamma == parameter(t.gamma));
+		if (s._get_no_of_parameters() != 4)
+		{
+			std::cerr << "unexpected number of parameters: " << s._get_no_of_parameters() << std::endl;
+			return 1;
+		}
+
+		auto p = db.prepare(s);
+		p.params.alpha = 7;
+		p.params.beta = "%kuchen";
+		p.dynamic_params[parameter(t.gamma)] = true;
+		auto copy = p;
+		copy.dynamic_params[parameter(t.gamma)] = false;
+
+		parameter_recorder_t recorder;
+		p.dynamic_params._bind(p.params, recorder);
+		parameter_recorder_t copy_recorder;
+		copy.dynamic_params._bind(copy.params, copy_recorder);
+		if (p.dynamic_params.size() != 1 or recorder.str() != "0:7 1:1 2:1 3:%kuchen " or copy_recorder.str() != "0:7 1:0 2:0 3:%kuchen ")
+		{
+			std::cerr << "unexpected dynamic parameter bindings: " << recorder.str() << " / " << copy_recorder.str() << std::endl;
+			return 1;
+		}
+
+		try
+		{
+			p.dynamic_params[parameter(t.alpha)] = 17;
+			std::cerr << "unknown dynamic parameter should throw" << std::endl;
+			return 1;
+		}
+		catch (const sqlpp::exception&)
+		{
+		}
+	}
+
+	// Statements without parameters in dynamic parts bind their static parameters as before
+	{
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where(t.alpha == parameter(t.alpha));
+		s.where.add(t.beta == "cheesecake");
+		auto p = db.prepare(s);
+		if (not p.dynamic_params.empty() or s._get_no_of_parameters() != 1)
+		{
+			std::cerr << "statement should not have dynamic parameters" << std::endl;
+			return 1;
+		}
+	}
+
 	return 0;
 }
@@ -44,6 +44,162 @@ namespace alias
 	SQLPP_ALIAS_PROVIDER(right);
 }
 
+// Produces batches of a result with the given number of rows, alpha is the row number, beta is NULL for odd rows
+struct fake_batch_result_t
+{
+	size_t _rows;
+	size_t _next;
+
+	template<typename ResultBatch>
+		void next_batch(ResultBatch& batch)
+		{
+			batch._bind(*this);
+			size_t rows = 0;
+			for (; rows < _capacity and _next < _rows; ++rows, ++_next)
+			{
+				_alpha[rows] = static_cast<int64_t>(_next);
+				if (_next % 2)
+					_beta_nulls[rows / 8] |= 1 << (rows % 8);
+				else
+					_beta_data->append(std::to_string(_next));
+				_beta_offsets[rows + 1] = _beta_data->size();
+			}
+			batch._set_size(rows);
+		}
+
+	void _bind_boolean_result_array(size_t, signed char*, unsigned char*, size_t) {}
+	void _bind_floating_point_result_array(size_t, double*, unsigned char*, size_t) {}
+
+	void _bind_integral_result_array(size_t index, int64_t* values, unsigned char*, size_t capacity)
+	{
+		_alpha = values;
+		_capacity = capacity;
+	}
+
+	void _bind_text_result_array(size_t index, size_t* offsets, std::string* data, unsigned char* null_bitmap, size_t)
+	{
+		_beta_offsets = offsets;
+		_beta_offsets[0] = 0;
+		_beta_data = data;
+		_beta_nulls = null_bitmap;
+	}
+
+	int64_t* _alpha;
+	size_t _capacity;
+	size_t* _beta_offsets;
+	std::string* _beta_data;
+	unsigned char* _beta_nulls;
+};
+
+size_t bind_once_binds = 0;
+
+// Uses result protocol 2, i.e. rows are bound once and next() only writes the values
+struct bind_once_result_t
+{
+	struct _tags
+	{
+		using _binds_result_once = std::true_type;
+	};
+
+	size_t _rows = 0;
+	size_t _next = 0;
+	int64_t* _alpha = nullptr;
+	bool* _alpha_is_null = nullptr;
+
+	bool operator==(const bind_once_result_t&) const
+	{
+		return true;
+	}
+
+	template<typename ResultRow>
+		void next(ResultRow& result_row)
+		{
+			if (_next == _rows)
+			{
+				result_row._invalidate();
+				return;
+			}
+			*_alpha = static_cast<int64_t>(_next++);
+			*_alpha_is_null = false;
+			if (not result_row)
+				result_row._validate();
+		}
+
+	void _bind_integral_result(size_t, int64_t* value, bool* is_null)
+	{
+		++bind_once_binds;
+		_alpha = value;
+		_alpha_is_null = is_null;
+	}
+};
+
+// Hands out the same values for each row, like a connector's result would bind them
+struct result_target_t
+{
+	int64_t _integral;
+	double _floating_point;
+	std::vector<std::string> _texts;
+
+	void _bind_boolean_result(size_t index, signed char* value, bool* is_null)
+	{
+		*value = true;
+		*is_null = false;
+	}
+
+	void _bind_floating_point_result(size_t index, double* value, bool* is_null)
+	{
+		*value = _floating_point;
+		*is_null = false;
+	}
+
+	void _bind_integral_result(size_t index, int64_t* value, bool* is_null)
+	{
+		*value = _integral;
+		*is_null = false;
+	}
+
+	void _bind_text_result(size_t index, const char** text, size_t* len)
+	{
+		*text = _texts.at(index).data();
+		*len = _texts.at(index).size();
+	}
+};
+
+struct trivial_null_db_t
+{
+	struct _tags
+	{
+		using _null_result_is_trivial_value = std::true_type;
+	};
+};
+
+struct null_target_t
+{
+	void _bind_boolean_result(size_t index, signed char* value, bool* is_null)
+	{
+		*value = false;
+		*is_null = true;
+	}
+
+	void _bind_floating_point_result(size_t index, double* value, bool* is_null)
+	{
+		*value = 0;
+		*is_null = true;
+	}
+
+	void _bind_integral_result(size_t index, int64_t* value, bool* is_null)
+	{
+		*value = 0;
+		*is_null = true;
+	}
+
+	void _bind_text_result(size_t index, const char** text, size_t* len)
+	{
+		*text = nullptr;
+		*len = 0;
+	}
+};
+
 int main()
 {
 	test::TabFoo f; 
@@ -95,5 +251,130 @@ int main()
 	printer.reset();
 	std::cerr << serialize(stat, printer).str() << std::endl;
 
+	// Dynamic fields are stored by position, names can be resolved once into handles
+	{
+		sqlpp::dynamic_result_row_t<MockDb> row({"omega", "kappa"});
+		result_target_t target{17, 1.5, {"1.5", "cheesecake"}};
+		row._validate();
+		row._bind(target);
+		const auto kappa = row.get_handle("kappa");
+		if (row.dynamic_size() != 2 or row[kappa] != "cheesecake" or row.at(kappa) != "cheesecake" or row.at("omega") != "1.5"
+				or row[kappa].text().view() != "cheesecake" or row[kappa].text().view().data() != target._texts[1].data())
+		{
+			std::cerr << "unexpected dynamic fields" << std::endl;
+			return 1;
+		}
+	}
+
+	// Dynamic fields keep the value type of their column
+	{
+		auto d = dynamic_select(db).dynamic_columns(t.beta).from(t);
+		d.selected_columns.add(t.alpha);
+		d.selected_columns.add(f.omega);
+		using row_t = decltype(d)::_result_row_t<MockDb>;
+		row_t row(d.get_dynamic_names(), d._get_dynamic_types());
+		result_target_t target{17, 1.5, {"cheesecake"}};
+		row._validate();
+		row._bind(target);
+		const auto alpha = row.get_handle("alpha");
+		const auto omega = row.get_handle("omega");
+		if (row[alpha].get_type() != sqlpp::dynamic_field_type_t::integral or row[alpha].integral().value() != 17
+				or row[omega].floating_point().value() != 1.5 or row[alpha] != "17" or row.beta.value() != "cheesecake")
+		{
+			std::cerr << "unexpected typed dynamic fields" << std::endl;
+			return 1;
+		}
+
+		if (sizeof(sqlpp::dynamic_field_t<MockDb>) > sizeof(sqlpp::dynamic_field_type_t) + sizeof(sqlpp::dynamic_field_t<MockDb>::_text_entry_t)
+				+ alignof(sqlpp::dynamic_field_t<MockDb>::_text_entry_t))
+		{
+			std::cerr << "dynamic fields should only store the entry of their value type" << std::endl;
+			return 1;
+		}
+
+		try
+		{
+			row[alpha].text();
+			std::cerr << "accessing a dynamic field with the wrong type should throw" << std::endl;
+			return 1;
+		}
+		catch (const sqlpp::exception&)
+		{
+		}
+	}
+
+	// NULL is returned as empty text for all value types
+	{
+		sqlpp::dynamic_field_t<trivial_null_db_t> integral(sqlpp::dynamic_field_type_t::integral);
+		sqlpp::dynamic_field_t<trivial_null_db_t> text(sqlpp::dynamic_field_type_t::text);
+		null_target_t target;
+		integral._validate();
+		integral._bind(target, 0);
+		text._validate();
+		text._bind(target, 0);
+		if (not integral.is_null() or integral.value() != "" or integral.value() != text.value())
+		{
+			std::cerr << "unexpected NULL dynamic field: " << integral.value() << std::endl;
+			return 1;
+		}
+	}
+
+	// Results can be fetched in batches of columns
+	{
+		for (const auto& batch : fetch_batches(db, select(t.alpha, t.beta).from(t).where(true), 16))
+		{
+			std::cout << batch.size() << std::endl;
+		}
+
+		using batch_t = decltype(select(t.alpha, t.beta).from(t))::_result_batch_t<MockDb>;
+		sqlpp::batch_result_t<fake_batch_result_t, batch_t> result(fake_batch_result_t{20, 0}, 8);
+		std::vector<size_t> sizes;
+		int64_t sum = 0;
+		std::string texts;
+		for (const auto& batch : result)
+		{
+			sizes.push_back(batch.size());
+			for (size_t i = 0; i < batch.size(); ++i)
+			{
+				sum += batch.alpha[i];
+				if (not batch.beta.is_null(i))
+					texts += batch.beta[i].str() + ",";
+			}
+		}
+		if (sizes != std::vector<size_t>{8, 8, 4} or sum != 190 or texts != "0,2,4,6,8,10,12,14,16,18,")
+		{
+			std::cerr << "unexpected result batches: " << sum << " " << texts << std::endl;
+			return 1;
+		}
+	}
+
+	// Connectors with result protocol 2 bind each row once, and again after it has been moved
+	{
+		using row_t = decltype(select(t.alpha).from(t))::_result_row_t<MockDb>;
+		bind_once_result_t once;
+		once._rows = 10;
+		sqlpp::result_t<bind_once_result_t, row_t> result(std::move(once), std::vector<std::string>{});
+		auto moved = std::move(result);
+		int64_t sum = 0;
+		for (const auto& row : moved)
+			sum += row.alpha;
+		if (sum != 45 or moved.front() or bind_once_binds != 2)
+		{
+			std::cerr << "unexpected result of a connector that binds once: " << sum << std::endl;
+			return 1;
+		}
+
+		using result_t = sqlpp::result_t<bind_once_result_t, row_t>;
+		result_t empty;
+		result_t moved_empty(std::move(empty));
+		empty = std::move(moved_empty);
+		result_t exhausted(std::move(moved));
+		if (bind_once_binds != 2)
+		{
+			std::cerr << "results without a row should not be bound again: " << bind_once_binds << std::endl;
+			return 1;
+		}
+	}
+
 	return 0;
 }
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/select.h>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/functions.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace
+{
+	std::size_t allocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	++allocations;
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	long long micros_since(const clock_type::time_point& start)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - start).count();
+	}
+
+	// What serialization cost before the length hint: a length walk for every statement, then the serialization
+	template<typename Statement>
+		std::size_t serialize_with_length_walk(const Statement& s)
+		{
+			MockDb::_serializer_context_t context;
+			context.reserve(sqlpp::serialized_length(s));
+			serialize(s, context);
+			return context.size();
+		}
+
+	template<typename Statement>
+		std::size_t serialize_with_length_hint(const Statement& s)
+		{
+			MockDb::_serializer_context_t context;
+			serialize(s, context);
+			return context.size();
+		}
+}
+
+int main()
+{
+	MockDb db;
+	test::TabBar t;
+
+	const std::size_t count = 100000;
+	std::size_t total = 0;
+
+	// A typical dynamic statement, which fits into the inline buffer of the context
+	auto small = dynamic_select(db, t.alpha, t.beta).from(t).dynamic_where(t.alpha > 7).order_by(t.beta.asc()).limit(10);
+	small.where.add(t.beta == "cheesecake");
+	small.where.add(t.gamma == true);
+
+	serialize_with_length_hint(small); // the first statement of a type is sized by a length walk
+	allocations = 0;
+	total += serialize_with_length_hint(small);
+	if (allocations != 0)
+	{
+		std::cerr << "small statements should not allocate: " << allocations << std::endl;
+		return 1;
+	}
+
+	long long walk_micros = 0;
+	long long hint_micros = 0;
+	{
+		const auto start = clock_type::now();
+		for (std::size_t i = 0; i < count; ++i)
+			total += serialize_with_length_walk(small);
+		walk_micros = micros_since(start);
+	}
+	{
+		const auto start = clock_type::now();
+		for (std::size_t i = 0; i < count; ++i)
+			total += serialize_with_length_hint(small);
+		hint_micros = micros_since(start);
+	}
+	std::cout << "serializing " << count << " small dynamic statements: " << walk_micros << "us with length walk, "
+		<< hint_micros << "us with length hint" << std::endl;
+
+	// Large statements are still sized exactly, with a single allocation
+	auto large = insert_into(t).columns(t.beta, t.gamma);
+	for (int i = 0; i < 10000; ++i)
+		large.values.add(t.beta = "row " + std::to_string(i), t.gamma = (i % 2 == 0));
+
+	const auto large_size = serialize_with_length_hint(large);
+	allocations = 0;
+	total += serialize_with_length_hint(large);
+	std::cout << "serializing an insert of " << large_size << " characters: " << allocations << " allocation(s)" << std::endl;
+	if (allocations != 1)
+	{
+		std::cerr << "large statements should be sized once" << std::endl;
+		return 1;
+	}
+
+	{
+		const std::size_t large_count = 100;
+		const auto start = clock_type::now();
+		for (std::size_t i = 0; i < large_count; ++i)
+			total += serialize_with_length_hint(large);
+		std::cout << "serializing " << large_count << " large inserts: " << micros_since(start) << "us" << std::endl;
+	}
+
+	return total ? 0 : 1;
+}
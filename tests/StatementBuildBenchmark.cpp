@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/select.h>
+#include <sqlpp11/functions.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace
+{
+	// Every copy of the large verbatim texts below shows up as one large allocation
+	const std::size_t large_size = 1000;
+	std::size_t allocations = 0;
+	std::size_t large_allocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	++allocations;
+	if (size >= large_size)
+		++large_allocations;
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	long long micros_since(const clock_type::time_point& start)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - start).count();
+	}
+
+	const std::string condition = "tab_bar.beta = '" + std::string(large_size, 'x') + "'";
+
+	// Each clause is added to a temporary, which is moved into the next statement
+	std::size_t build_chained(MockDb& db, test::TabBar& t)
+	{
+		auto s = dynamic_select(db).dynamic_columns(t.alpha).dynamic_flags().from(t)
+			.dynamic_where(sqlpp::verbatim<sqlpp::boolean>(condition))
+			.dynamic_group_by(t.alpha)
+			.dynamic_having(sqlpp::verbatim<sqlpp::boolean>(condition))
+			.dynamic_order_by(t.alpha.asc())
+			.dynamic_limit()
+			.dynamic_offset();
+		s.selected_columns.add(t.beta);
+		return sizeof(s);
+	}
+
+	// Each clause is added to a named statement, which has to be copied into the next statement
+	std::size_t build_stepwise(MockDb& db, test::TabBar& t)
+	{
+		auto s1 = dynamic_select(db).dynamic_columns(t.alpha);
+		auto s2 = s1.dynamic_flags();
+		auto s3 = s2.from(t);
+		auto s4 = s3.dynamic_where(sqlpp::verbatim<sqlpp::boolean>(condition));
+		auto s5 = s4.dynamic_group_by(t.alpha);
+		auto s6 = s5.dynamic_having(sqlpp::verbatim<sqlpp::boolean>(condition));
+		auto s7 = s6.dynamic_order_by(t.alpha.asc());
+		auto s8 = s7.dynamic_limit();
+		auto s9 = s8.dynamic_offset();
+		s9.selected_columns.add(t.beta);
+		return sizeof(s9);
+	}
+
+	// Many small dynamic conditions, as built by a search form
+	const std::size_t search_conditions = 40;
+
+	template<typename Statement>
+		void add_search_conditions(Statement& s, test::TabBar& t)
+		{
+			for (std::size_t i = 0; i < search_conditions; ++i)
+				s.where.add(t.alpha != static_cast<long>(i));
+		}
+}
+
+int main()
+{
+	MockDb db;
+	test::TabBar t;
+
+	const std::size_t count = 10000;
+	std::size_t total = 0;
+
+	allocations = 0;
+	large_allocations = 0;
+	total += build_chained(db, t);
+	const std::size_t chained_copies = large_allocations;
+	const std::size_t chained_allocations = allocations;
+
+	allocations = 0;
+	large_allocations = 0;
+	total += build_stepwise(db, t);
+	const std::size_t stepwise_copies = large_allocations;
+	const std::size_t stepwise_allocations = allocations;
+
+	std::cout << "chained:  " << chained_copies << " copies of large texts, " << chained_allocations << " allocations" << std::endl;
+	std::cout << "stepwise: " << stepwise_copies << " copies of large texts, " << stepwise_allocations << " allocations" << std::endl;
+
+	// The two texts are allocated once each when the verbatim expressions are created
+	if (chained_copies != 2)
+	{
+		std::cerr << "chained statement building copies data" << std::endl;
+		return 1;
+	}
+
+	// Small dynamic conditions are stored inline and copied by value
+	{
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where();
+		allocations = 0;
+		add_search_conditions(s, t);
+		const std::size_t add_allocations = allocations;
+
+		allocations = 0;
+		auto copy = s;
+		const std::size_t copy_allocations = allocations;
+		total += copy.where._data._dynamic_expressions.size();
+
+		std::cout << "search:   " << add_allocations << " allocations for " << search_conditions << " conditions, " << copy_allocations << " for copying" << std::endl;
+		if (add_allocations >= search_conditions or copy_allocations != 1)
+		{
+			std::cerr << "small dynamic conditions are allocated separately" << std::endl;
+			return 1;
+		}
+	}
+
+	// With an arena, the dynamic parts of the statement and of its copies do not allocate at all (once the arena has a block)
+	{
+		sqlpp::monotonic_arena_t arena(16384);
+		arena.allocate(1, 1);
+		auto s = dynamic_select(db, arena, t.alpha).from(t).dynamic_where();
+		allocations = 0;
+		add_search_conditions(s, t);
+		auto copy = s;
+		const std::size_t arena_allocations = allocations;
+		total += copy.where._data._dynamic_expressions.size();
+
+		std::cout << "arena:    " << arena_allocations << " allocations for " << search_conditions << " conditions and copying, " << arena._get_no_of_blocks() << " block(s)" << std::endl;
+		if (arena_allocations != 0 or arena._get_no_of_blocks() != 1)
+		{
+			std::cerr << "dynamic conditions are not allocated from the arena" << std::endl;
+			return 1;
+		}
+	}
+
+	{
+		const auto start = clock_type::now();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			sqlpp::monotonic_arena_t arena(16384);
+			auto s = dynamic_select(db, arena, t.alpha).from(t).dynamic_where();
+			add_search_conditions(s, t);
+			auto copy = s;
+			total += copy.where._data._dynamic_expressions.size();
+		}
+		std::cout << "building and copying " << count << " statements with " << search_conditions << " conditions in an arena: " << micros_since(start) << "us" << std::endl;
+	}
+
+	{
+		const auto start = clock_type::now();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			auto s = dynamic_select(db, t.alpha).from(t).dynamic_where();
+			add_search_conditions(s, t);
+			auto copy = s;
+			total += copy.where._data._dynamic_expressions.size();
+		}
+		std::cout << "building and copying " << count << " statements with " << search_conditions << " conditions: " << micros_since(start) << "us" << std::endl;
+	}
+
+	{
+		const auto start = clock_type::now();
+		for (std::size_t i = 0; i < count; ++i)
+			total += build_chained(db, t);
+		std::cout << "building " << count << " chained statements: " << micros_since(start) << "us" << std::endl;
+	}
+	{
+		const auto start = clock_type::now();
+		for (std::size_t i = 0; i < count; ++i)
+			total += build_stepwise(db, t);
+		std::cout << "building " << count << " stepwise statements: " << micros_since(start) << "us" << std::endl;
+	}
+
+	return total ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2013-2014, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/select.h>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/update.h>
+#include <sqlpp11/remove.h>
+#include <iostream>
+#include <tuple>
+
+MockDb db = {};
+
+namespace
+{
+	// A statement must not be bigger than the data of its non-empty parts (laid out as a tuple)
+	template<typename Statement, typename... Data>
+		bool check_size(const char* name, const Statement&, const Data&...)
+		{
+			const auto expected = sizeof(std::tuple<Data...>);
+			if (sizeof(Statement) > expected)
+			{
+				std::cerr << name << " is larger than its data: " << sizeof(Statement) << " bytes (data: " << expected << ")" << std::endl;
+				return false;
+			}
+			return true;
+		}
+}
+
+int main()
+{
+	test::TabBar t;
+
+	// Statements without data (only empty policies like no_where_t) take no storage
+	static_assert(std::is_empty<decltype(sqlpp::select())>::value, "empty select has to be an empty class");
+	static_assert(std::is_empty<decltype(sqlpp::insert())>::value, "empty insert has to be an empty class");
+	static_assert(std::is_empty<sqlpp::blank_update_t<void>>::value, "blank update has to be an empty class");
+	static_assert(std::is_empty<decltype(sqlpp::remove())>::value, "empty remove has to be an empty class");
+
+	{
+		auto s = select(t.alpha).from(t).where(true);
+		if (not check_size("select", s, s.selected_columns._data, s.from._data, s.where._data))
+			return 1;
+	}
+
+	{
+		auto s = select(all_of(t)).from(t).where(t.alpha > 7).order_by(t.beta.asc()).limit(10);
+		if (not check_size("select with order_by and limit", s, s.selected_columns._data, s.from._data, s.where._data, s.order_by._data, s.limit._data))
+			return 1;
+	}
+
+	{
+		// Dynamic statements also point to the arena for their dynamic parts (if any)
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where();
+		if (not check_size("dynamic select", s, s.selected_columns._data, s.from._data, s.where._data, s._get_arena()))
+			return 1;
+	}
+
+	{
+		auto i = insert_into(t).set(t.gamma = true);
+		if (not check_size("insert", i, i.into._data, i.insert_list._data))
+			return 1;
+	}
+
+	{
+		auto i = insert_into(t).default_values();
+		if (not check_size("insert default values", i, i.into._data))
+			return 1;
+	}
+
+	{
+		auto u = update(t).set(t.gamma = false).where(t.beta == "cheesecake");
+		if (not check_size("update", u, u.from._data, u.assignments._data, u.where._data))
+			return 1;
+	}
+
+	{
+		auto r = remove_from(t).where(t.alpha == 17);
+		if (not check_size("remove", r, r.from._data, r.where._data))
+			return 1;
+	}
+
+	return 0;
+}